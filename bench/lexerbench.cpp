@@ -0,0 +1,102 @@
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "context/context.hpp"
+#include "lexer/lexer.hpp"
+
+/**
+ * @brief lines used to build the corpus, they cover every token class of the language
+ */
+const std::vector<std::string> corpusLines = {
+	"Vector struct",
+	"\tx -> float",
+	"\ty -> float",
+	"tcurts",
+	"fibonacci int n -> int fun",
+	"\tn 2 < if",
+	"\t\tn return",
+	"\tfi",
+	"\tn 1 - :fibonacci n 2 - :fibonacci + return",
+	"nuf",
+	"process int -> int funsig",
+	"apply list[int] values $process callback -> list[int] fun",
+	"\tresult 0 list[int] =",
+	"\ti 0 values :len 1 for",
+	"\t\tresult values i get :callback :push",
+	"\trof",
+	"\tresult return",
+	"nuf",
+	"\"math\" import",
+	"\"time\" \"chrono\" importAs",
+	"MAX_SIZE 1024 =",
+	"flags 0b1011 0x1F + =",
+	"ratio -3.75 .5 * =",
+	"v 10.0 -20.0 Vector =",
+	"v->x v->x 2 ^ v->y 2 ^ + :math.sqrt / =",
+	"total 0 =",
+	"i 0 MAX_SIZE 1 for",
+	"\ttotal i 3 % 0 == i 5 % 0 != :and if total i + else total fi =",
+	"rof",
+	"a 1 2 3 3 list[int] =",
+	"b a a .+ 2 .* =",
+	"running true =",
+	"running false == while",
+	"\ttotal 1 - total =; running total 0 > =",
+	"elihw",
+	"x try",
+	"\t\"file.txt\" :fs.read",
+	"catch",
+	"\tx f\"error {} in {}\" :print",
+	"yrt",
+	"total f\"{}\\n\" :print # display the result",
+};
+
+int main(int argc, char **argv) {
+	const size_t megabytes = argc > 1 ? std::stoul(argv[1]) : 32;
+	const size_t targetSize = megabytes * 1024 * 1024;
+
+	std::vector<std::string> lines;
+	size_t corpusSize = 0;
+	while (corpusSize < targetSize) {
+		for (const std::string &line : corpusLines) {
+			lines.push_back(line);
+			corpusSize += line.size() + 1;
+		}
+	}
+
+	const auto context = std::make_shared<Context>("bench", "<bench>");
+	std::deque<Token *> tokens;
+	std::chrono::nanoseconds elapsed{0};
+	size_t tokenCount = 0;
+	constexpr size_t batchSize = 4096;
+	for (size_t start = 0; start < lines.size(); start += batchSize) {
+		const size_t end = std::min(start + batchSize, lines.size());
+		Arena arena;
+		const auto begin = std::chrono::steady_clock::now();
+		for (size_t i = start; i < end; i++) {
+			ExpressionResult result = Lexer::tokenize(i + 1, lines[i], tokens, arena, context);
+			if (result.error()) {
+				result.displayLineError(lines[i]);
+				return 1;
+			}
+		}
+		elapsed += std::chrono::steady_clock::now() - begin;
+		tokenCount += tokens.size();
+		tokens.clear();
+	}
+
+	const double seconds = std::chrono::duration<double>(elapsed).count();
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "lines:      " << lines.size() << std::endl;
+	std::cout << "tokens:     " << tokenCount << std::endl;
+	std::cout << "corpus:     " << static_cast<double>(corpusSize) / (1024 * 1024) << " MB"
+			  << std::endl;
+	std::cout << "time:       " << seconds * 1000 << " ms" << std::endl;
+	std::cout << "throughput: " << static_cast<double>(corpusSize) / (1024 * 1024) / seconds
+			  << " MB/s" << std::endl;
+	return 0;
+}
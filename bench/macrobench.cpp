@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <pty.h>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * @brief wall time and memory of the runs of a program
+ */
+struct Measure {
+	std::string name;
+	double medianMs;
+	double p95Ms;
+	long peakRssKb;
+};
+
+struct Options {
+	int runs = 5;
+	int warmups = 1;
+	double threshold = 10.0; // percents of the baseline median
+	std::string outputPath = "bench.json";
+	std::string baselinePath;
+	std::string interpreter;
+	std::vector<std::string> programs;
+};
+
+/**
+ * @brief run a program with the interpreter, its output is discarded. The interpreter reads a
+ * script from stdin when stdin isn't a terminal so it gets a pseudo terminal instead. The program
+ * cache is disabled so every run compiles the program and the cache of the user is left untouched
+ *
+ * @param interpreter the path of the interpreter
+ * @param program the script to run
+ * @param elapsedMs the wall time of the run
+ * @param maxRssKb the peak resident memory of the run
+ * @return bool true if the program succeeded
+ */
+bool runProgram(const std::string &interpreter, const std::string &program, double &elapsedMs,
+				long &maxRssKb) {
+	int master = 0;
+	int slave = 0;
+	if (openpty(&master, &slave, nullptr, nullptr, nullptr) != 0) {
+		std::cerr << "Can't open a pseudo terminal" << std::endl;
+		return false;
+	}
+	const auto begin = std::chrono::steady_clock::now();
+	const pid_t pid = fork();
+	if (pid == 0) {
+		const int null = open("/dev/null", O_WRONLY);
+		dup2(slave, STDIN_FILENO);
+		dup2(null, STDOUT_FILENO);
+		dup2(null, STDERR_FILENO);
+		close(master);
+		close(slave);
+		close(null);
+		execl(interpreter.c_str(), interpreter.c_str(), "--no-cache", program.c_str(), nullptr);
+		_exit(127);
+	}
+	close(slave);
+	int status = 0;
+	rusage usage{};
+	const bool waited = pid > 0 && wait4(pid, &status, 0, &usage) == pid;
+	const std::chrono::duration<double, std::milli> elapsed =
+		std::chrono::steady_clock::now() - begin;
+	close(master);
+	elapsedMs = elapsed.count();
+	maxRssKb = usage.ru_maxrss;
+	return waited && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/**
+ * @brief find the value of a percentile with the nearest rank method
+ *
+ * @param sorted the values, sorted in ascending order
+ * @param percentile the percentile between 0 and 100
+ * @return double the smallest value greater than or equal to the percentile of the values
+ */
+double percentile(const std::vector<double> &sorted, double percentile) {
+	const auto rank = static_cast<size_t>(percentile / 100.0 * sorted.size() + 0.999999);
+	return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+std::string programName(const std::string &path) {
+	const size_t start = path.find_last_of('/') + 1;
+	return path.substr(start, path.find_last_of('.') - start);
+}
+
+void writeResults(std::ostream &stream, const Options &options,
+				  const std::vector<Measure> &measures) {
+	stream << std::fixed << std::setprecision(2);
+	stream << "{\n";
+	stream << "\t\"runs\": " << options.runs << ",\n";
+	stream << "\t\"warmups\": " << options.warmups << ",\n";
+	stream << "\t\"benchmarks\": [";
+	const char *separator = "\n";
+	for (const Measure &measure : measures) {
+		stream << separator << "\t\t{\"name\": \"" << measure.name
+			   << "\", \"medianMs\": " << measure.medianMs << ", \"p95Ms\": " << measure.p95Ms
+			   << ", \"peakRssKb\": " << measure.peakRssKb << "}";
+		separator = ",\n";
+	}
+	stream << "\n\t]\n}\n";
+}
+
+/**
+ * @brief read the medians of a file written by writeResults, each benchmark is on its own line
+ *
+ * @param path the baseline file
+ * @param medians the median of each benchmark by name
+ * @return bool false if the file can't be read or if a median isn't a number
+ */
+bool readBaseline(const std::string &path, std::map<std::string, double> &medians) {
+	std::ifstream file(path);
+	if (!file) {
+		return false;
+	}
+	std::string line;
+	while (std::getline(file, line)) {
+		const size_t name = line.find("\"name\": \"");
+		const size_t median = line.find("\"medianMs\": ");
+		if (name == std::string::npos || median == std::string::npos) {
+			continue;
+		}
+		const size_t nameStart = name + sizeof("\"name\": \"") - 1;
+		const char *value = line.c_str() + median + sizeof("\"medianMs\": ") - 1;
+		char *end = nullptr;
+		const double medianMs = std::strtod(value, &end);
+		if (end == value) {
+			return false;
+		}
+		medians[line.substr(nameStart, line.find('"', nameStart) - nameStart)] = medianMs;
+	}
+	return true;
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+	int index = 1;
+	for (; index + 1 < argc && std::string_view(argv[index]).starts_with("--"); index += 2) {
+		const std::string_view option = argv[index];
+		const std::string value = argv[index + 1];
+		if (option == "--runs" || option == "--warmups" || option == "--threshold") {
+			char *end = nullptr;
+			const double number = std::strtod(value.c_str(), &end);
+			if (end == value.c_str() || *end != '\0') {
+				return false;
+			}
+			if (option == "--runs") {
+				options.runs = std::max(1, static_cast<int>(number));
+			} else if (option == "--warmups") {
+				options.warmups = std::max(0, static_cast<int>(number));
+			} else {
+				options.threshold = number;
+			}
+		} else if (option == "--output") {
+			options.outputPath = value;
+		} else if (option == "--compare") {
+			options.baselinePath = value;
+		} else {
+			return false;
+		}
+	}
+	if (index + 1 >= argc) {
+		return false;
+	}
+	options.interpreter = argv[index];
+	options.programs.assign(argv + index + 1, argv + argc);
+	return true;
+}
+
+int main(int argc, char **argv) {
+	Options options;
+	if (!parseOptions(argc, argv, options)) {
+		std::cerr << "Usage: RPNlangMacroBench [--runs n] [--warmups n] [--output file] "
+					 "[--compare baseline] [--threshold percents] interpreter program..."
+				  << std::endl;
+		return 1;
+	}
+	std::map<std::string, double> baseline;
+	if (!options.baselinePath.empty() && !readBaseline(options.baselinePath, baseline)) {
+		std::cerr << "Can't read the baseline " << options.baselinePath << std::endl;
+		return 1;
+	}
+
+	std::vector<Measure> measures;
+	bool regressed = false;
+	std::cout << std::fixed << std::setprecision(2);
+	for (const std::string &program : options.programs) {
+		std::vector<double> times;
+		long peakRssKb = 0;
+		for (int run = 0; run < options.warmups + options.runs; run++) {
+			double elapsedMs = 0;
+			long maxRssKb = 0;
+			if (!runProgram(options.interpreter, program, elapsedMs, maxRssKb)) {
+				std::cerr << program << " failed, run it with the interpreter to see the error"
+						  << std::endl;
+				return 1;
+			}
+			if (run >= options.warmups) {
+				times.push_back(elapsedMs);
+				peakRssKb = std::max(peakRssKb, maxRssKb);
+			}
+		}
+		std::sort(times.begin(), times.end());
+		const Measure measure{programName(program), percentile(times, 50),
+							  percentile(times, 95), peakRssKb};
+		measures.push_back(measure);
+
+		std::cout << std::left << std::setw(16) << measure.name << std::right << " median "
+				  << std::setw(10) << measure.medianMs << " ms  p95 " << std::setw(10)
+				  << measure.p95Ms << " ms  peak RSS " << std::setw(8) << measure.peakRssKb
+				  << " kB";
+		if (const auto previous = baseline.find(measure.name); previous != baseline.end()) {
+			const double change = (measure.medianMs / previous->second - 1.0) * 100.0;
+			std::cout << "  " << std::showpos << change << std::noshowpos << " %";
+			if (change > options.threshold) {
+				std::cout << "  REGRESSION";
+				regressed = true;
+			}
+		}
+		std::cout << std::endl;
+	}
+
+	std::ofstream output(options.outputPath);
+	if (!output) {
+		std::cerr << "Can't write the results in " << options.outputPath << std::endl;
+		return 1;
+	}
+	writeResults(output, options, measures);
+	return regressed ? 1 : 0;
+}
@@ -0,0 +1,276 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "context/context.hpp"
+#include "cppmodule/cppmodule.hpp"
+#include "lexer/lexer.hpp"
+#include "rpnfunctions/builtinmap.hpp"
+#include "tokens/tokens/operatortoken.hpp"
+#include "value/types/function.hpp"
+#include "value/types/list.hpp"
+#include "value/types/numbers/bool.hpp"
+#include "value/types/numbers/float.hpp"
+#include "value/types/numbers/int.hpp"
+#include "value/types/string.hpp"
+#include "value/types/struct.hpp"
+
+// every allocation of the benchmarks goes through the global operator new
+std::atomic<uint64_t> allocationCount = 0;
+// the values read by the benchmarks are accumulated so the reads aren't optimized out
+volatile uintptr_t sink = 0;
+
+void *operator new(std::size_t size) {
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void *pointer = std::malloc(size == 0 ? 1 : size)) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept {
+	std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t /*size*/) noexcept {
+	std::free(pointer);
+}
+
+/**
+ * @brief time an operation and count its allocations, the number of iterations doubles until a
+ * batch lasts long enough to be measured
+ *
+ * @param name the name of the benchmark
+ * @param operations the number of operations done by one call of the function
+ * @param function the code to measure
+ */
+void measure(std::string_view name, size_t operations, const std::function<void()> &function) {
+	constexpr std::chrono::milliseconds minimalDuration(200);
+	function();
+	for (size_t iterations = 1;; iterations *= 2) {
+		const uint64_t allocations = allocationCount.load(std::memory_order_relaxed);
+		const auto begin = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < iterations; i++) {
+			function();
+		}
+		const std::chrono::duration<double, std::nano> elapsed =
+			std::chrono::steady_clock::now() - begin;
+		if (elapsed < minimalDuration) {
+			continue;
+		}
+		const double count = static_cast<double>(iterations * operations);
+		std::cout << std::left << std::setw(40) << name << std::right << std::setw(12)
+				  << elapsed.count() / count << " ns/op" << std::setw(10)
+				  << (allocationCount.load(std::memory_order_relaxed) - allocations) / count
+				  << " allocs/op" << std::endl;
+		return;
+	}
+}
+
+/**
+ * @brief generate a script made of function definitions and top level code, every function has
+ * its own name so the analyzer accepts the script
+ */
+std::vector<std::string> generateScript(size_t functionCount) {
+	std::vector<std::string> lines;
+	for (size_t i = 0; i < functionCount; i++) {
+		const std::string n = std::to_string(i);
+		lines.push_back("function" + n + " int a float b -> float fun");
+		lines.push_back("\tresult a b * " + n + " + 2.5 / =");
+		lines.push_back("\tresult 0.0 < if");
+		lines.push_back("\t\tresult -1.0 * return");
+		lines.push_back("\tfi");
+		lines.push_back("\tresult return");
+		lines.push_back("nuf");
+		lines.push_back("value" + n + " " + n + " 3 * 7 % =");
+		lines.push_back("name" + n + " \"item\" =");
+		lines.push_back("value" + n + " 2 > if");
+		lines.push_back("\tvalue" + n + " value" + n + " 1 - =");
+		lines.push_back("fi");
+	}
+	return lines;
+}
+
+void benchLexer() {
+	const std::vector<std::string> script = generateScript(10);
+	const std::vector<std::string_view> lines(script.begin(), script.end());
+	const auto context = std::make_shared<Context>("bench", "<bench>");
+
+	measure("Lexer::tokenize (line)", lines.size(), [&] {
+		Arena arena;
+		std::deque<Token *> tokens;
+		for (size_t i = 0; i < lines.size(); i++) {
+			Lexer::tokenize(i + 1, lines[i], tokens, arena, context);
+		}
+	});
+	// sequential so the time isn't shared with the thread pool
+	ThreadPool pool(0);
+	measure("Lexer::lex + Analyzer (line)", lines.size(), [&] {
+		Arena arena;
+		const auto fileContext = std::make_shared<Context>("bench", "<bench>");
+		Lexer lexer({}, arena, fileContext);
+		if (lexer.lexLines(lines, pool).error()) {
+			std::cerr << "The generated script is invalid" << std::endl;
+			std::exit(1);
+		}
+	});
+}
+
+void benchContext() {
+	const auto context = std::make_shared<Context>("bench", "<bench>");
+	std::vector<Symbol> names;
+	for (int i = 0; i < 64; i++) {
+		names.emplace_back("variable" + std::to_string(i));
+		context->setValue(names.back(), new Int(i, TextRange(), Value::INTERPRETER));
+	}
+	measure("Context::getValue", names.size(), [&] {
+		for (const Symbol &name : names) {
+			sink = sink + reinterpret_cast<uintptr_t>(context->getValue(name));
+		}
+	});
+	measure("Context::setValue", names.size(), [&] {
+		for (const Symbol &name : names) {
+			context->setValue(name, new Int(2048, TextRange(), Value::INTERPRETER));
+		}
+	});
+}
+
+void benchOperators() {
+	const auto context = std::make_shared<Context>("bench", "<bench>");
+	const TextRange range(1, 0, 1);
+	const std::vector<Value *> operands = {
+		new Int(1500, range, Value::CONSTANT), new Float(2.5F, range, Value::CONSTANT),
+		new String("text", range, Value::CONSTANT), Bool::create(true, range)};
+	for (const std::string_view op : {"+", "*", "==", "<"}) {
+		const OperatorToken token(range, TokenType::TOKEN_TYPE_OPERATOR, op);
+		for (Value *left : operands) {
+			for (Value *right : operands) {
+				// the analyzer only allows to multiply a string by an integer
+				if (op == "*" && left->getType() == STRING && right->getType() != INT) {
+					continue;
+				}
+				Value *result = nullptr;
+				try {
+					result = left->applyOperator(right, &token, context);
+				} catch (const std::runtime_error &) {
+					continue;
+				}
+				Value::deleteValue(&result, Value::INTERPRETER);
+				const std::string name = "Value::applyOperator " + left->getStringType() + " " +
+										 std::string(op) + " " + right->getStringType();
+				measure(name, 1, [&] {
+					Value *value = left->applyOperator(right, &token, context);
+					Value::deleteValue(&value, Value::INTERPRETER);
+				});
+			}
+		}
+	}
+}
+
+void benchList() {
+	constexpr unsigned int size = 1000;
+	const TextRange range(1, 0, 1);
+	List list(range, Value::INTERPRETER, INT);
+	measure("List::push + List::pop", size, [&] {
+		for (unsigned int i = 0; i < size; i++) {
+			list.push(new Int(2048, range, Value::INTERPRETER));
+		}
+		for (unsigned int i = 0; i < size; i++) {
+			delete list.pop();
+		}
+	});
+	for (unsigned int i = 0; i < size; i++) {
+		list.push(new Int(i + 2048, range, Value::INTERPRETER));
+	}
+	measure("List::at", size, [&] {
+		for (unsigned int i = 0; i < size; i++) {
+			sink = sink + reinterpret_cast<uintptr_t>(list.at(i));
+		}
+	});
+	measure("List::insert + List::remove (middle)", 1, [&] {
+		list.insert(size / 2, new Int(2048, range, Value::INTERPRETER));
+		list.remove(size / 2);
+	});
+}
+
+void benchStruct() {
+	const auto context = std::make_shared<Context>("bench", "<bench>");
+	const TextRange range(1, 0, 1);
+	StructDefinition definition("BenchPoint");
+	definition.addMember("x", INT);
+	definition.addMember("y", FLOAT);
+	definition.addMember("label", STRING);
+	Struct::addStructDefinition(definition);
+
+	Struct point(range, "BenchPoint", Value::INTERPRETER);
+	Int x(1, range, Value::INTERPRETER);
+	Float y(2.0F, range, Value::INTERPRETER);
+	String label("point", range, Value::INTERPRETER);
+	point.setMembers({&x, &y, &label}, context);
+	measure("Struct::getMember (slot)", 1, [&] {
+		sink = sink + reinterpret_cast<uintptr_t>(point.getMember(1));
+	});
+	measure("Struct::getMember (name)", 1, [&] {
+		const size_t index =
+			Struct::getStructDefinition("BenchPoint").getMemberIndex("label");
+		sink = sink + reinterpret_cast<uintptr_t>(point.getMember(index));
+	});
+}
+
+/**
+ * @brief call a function the way the interpreter does, the arguments stay owned by the caller
+ */
+void benchCall(std::string_view name, const RPNFunction *function, std::vector<Value *> arguments) {
+	const auto context = std::make_shared<Context>("bench", "<bench>");
+	const TextRange range(1, 0, 1);
+	measure(name, 1, [&] {
+		RPNFunctionResult result = function->call(arguments, range, context);
+		if (Value **value = std::get_if<Value *>(&result)) {
+			Value::deleteValue(value, Value::INTERPRETER);
+		}
+	});
+}
+
+void benchFunctions() {
+	const TextRange range(1, 0, 1);
+	Int number(1500, range, Value::INTERPRETER);
+	String text("benchmark", range, Value::INTERPRETER);
+	measure("builtins::findSymbol", 1, [&] {
+		sink = sink + reinterpret_cast<uintptr_t>(builtins::findSymbol(Symbol("toFloat")));
+	});
+	benchCall("builtin call toFloat", builtins::findSymbol(Symbol("toFloat")), {&number});
+	benchCall("builtin call len", builtins::findSymbol(Symbol("len")), {&text});
+
+	CppModule module("math");
+	if (module.load(range).error()) {
+		std::cout << "The math module isn't built, its calls aren't measured" << std::endl;
+		return;
+	}
+	const ContextPtr moduleContext = module.getModuleContext();
+	Float value(2.0F, range, Value::INTERPRETER);
+	auto *sqrt = static_cast<Function *>(moduleContext->getValue(Symbol("sqrt")));
+	// the first call opens the library of a module imported from its manifest
+	benchCall("CppModule call math.sqrt", sqrt->getValue(), {&value});
+}
+
+int main() {
+	CppModule::registerStaticModules();
+	CppModule::setBuiltinModulesPath(std::filesystem::current_path().string() + "/RPNmodules");
+	std::cout << std::fixed << std::setprecision(2);
+	benchLexer();
+	benchContext();
+	benchOperators();
+	benchList();
+	benchStruct();
+	benchFunctions();
+	return 0;
+}
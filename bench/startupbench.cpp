@@ -0,0 +1,80 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "context/context.hpp"
+#include "lexer/lexer.hpp"
+#include "threadpool/threadpool.hpp"
+
+/**
+ * @brief generate a script made of function definitions and top level code, every function has
+ * its own name so the analyzer accepts the script
+ *
+ * @param lineCount the minimal number of lines of the script
+ * @return std::vector<std::string> the lines of the script
+ */
+std::vector<std::string> generateScript(size_t lineCount) {
+	std::vector<std::string> lines;
+	for (size_t i = 0; lines.size() < lineCount; i++) {
+		const std::string n = std::to_string(i);
+		lines.push_back("function" + n + " int a float b -> float fun");
+		lines.push_back("\tresult a b * " + n + " + 2.5 / =");
+		lines.push_back("\tresult 0.0 < if");
+		lines.push_back("\t\tresult -1.0 * return");
+		lines.push_back("\tfi");
+		lines.push_back("\tresult return");
+		lines.push_back("nuf");
+		lines.push_back("value" + n + " " + n + " 3 * 7 % =");
+		lines.push_back("name" + n + " \"item\" =");
+		lines.push_back("value" + n + " 2 > if");
+		lines.push_back("\tvalue" + n + " value" + n + " 1 - =");
+		lines.push_back("fi");
+	}
+	return lines;
+}
+
+int main(int argc, char **argv) {
+	const size_t lineCount = argc > 1 ? std::stoul(argv[1]) : 500000;
+	const std::vector<std::string> script = generateScript(lineCount);
+	const std::vector<std::string_view> lines(script.begin(), script.end());
+
+	std::vector<size_t> threadCounts{0, 1, 2, 4};
+	const size_t cores = std::thread::hardware_concurrency();
+	if (cores > 4) {
+		threadCounts.push_back(cores);
+	}
+
+	std::cout << "lines: " << lines.size() << std::endl;
+	// the analyzer always runs the function bodies on the shared pool, only the tokenization
+	// uses the pool of the row
+	std::cout << std::left << std::setw(14) << "threads" << std::right << std::setw(12)
+			  << "lex (ms)" << std::setw(16) << "analyze (ms)" << std::endl;
+	std::cout << std::fixed << std::setprecision(2);
+	for (const size_t threads : threadCounts) {
+		ThreadPool pool(threads);
+		const auto context = std::make_shared<Context>("bench", "<bench>");
+		Arena arena;
+		Lexer lexer({}, arena, context);
+		const auto begin = std::chrono::steady_clock::now();
+		ExpressionResult result = lexer.lexLines(lines, pool, false);
+		const auto lexed = std::chrono::steady_clock::now();
+		if (!result.error()) {
+			result = lexer.analyze();
+		}
+		const auto analyzed = std::chrono::steady_clock::now();
+		if (result.error()) {
+			result.displayLineError(lines[result.getRange().line - 1]);
+			return 1;
+		}
+		const std::chrono::duration<double, std::milli> lexTime = lexed - begin;
+		const std::chrono::duration<double, std::milli> analyzeTime = analyzed - lexed;
+		std::cout << std::left << std::setw(14)
+				  << (threads == 0 ? "sequential" : std::to_string(threads) + " threads")
+				  << std::right << std::setw(12) << lexTime.count() << std::setw(16)
+				  << analyzeTime.count() << std::endl;
+	}
+	return 0;
+}
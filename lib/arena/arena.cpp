@@ -0,0 +1,38 @@
+#include "arena/arena.hpp"
+
+#include <algorithm>
+
+Arena::Arena(size_t chunkSize) : chunkSize(chunkSize) {}
+
+Arena::~Arena() {
+	for (Destructor *it = this->destructors; it != nullptr; it = it->previous) {
+		it->destroy(it);
+	}
+}
+
+/**
+ * @brief get uninitialized memory from the current chunk, a new chunk is allocated when the
+ * current one is full
+ *
+ * @param size the size of the memory block
+ * @param alignment the alignment of the memory block
+ * @return void* the memory block
+ */
+void *Arena::allocate(size_t size, size_t alignment) {
+	void *memory = this->current;
+	if (memory == nullptr || std::align(alignment, size, memory, this->remaining) == nullptr) {
+		const size_t newChunkSize = std::max(this->chunkSize, size + alignment);
+		this->chunks.push_back(std::make_unique_for_overwrite<std::byte[]>(newChunkSize));
+		memory = this->chunks.back().get();
+		this->remaining = newChunkSize;
+		std::align(alignment, size, memory, this->remaining);
+	}
+	this->current = static_cast<std::byte *>(memory) + size;
+	this->remaining -= size;
+	this->allocatedBytes += size;
+	return memory;
+}
+
+size_t Arena::getAllocatedBytes() const {
+	return this->allocatedBytes;
+}
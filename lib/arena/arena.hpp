@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief tell the arena that a type doesn't need its destructor to be called, it can be
+ * specialized for polymorphic types which don't own any resource. Their virtual destructor makes
+ * them non trivially destructible but registering it would only cost memory
+ */
+template <typename T>
+struct ArenaTriviallyDestructible : std::is_trivially_destructible<T> {};
+
+/**
+ * @brief bump allocator for the tokens and the blocks of a compilation unit. Objects are never
+ * freed one by one, the destructors and the memory of everything created in the arena are
+ * released at once when the arena is destroyed
+ */
+class Arena {
+  public:
+	explicit Arena(size_t chunkSize = 64 * 1024);
+	Arena(const Arena &other) = delete;
+	Arena &operator=(const Arena &other) = delete;
+	~Arena();
+
+	void *allocate(size_t size, size_t alignment);
+
+	template <typename T, typename... Args>
+	T *create(Args &&...args) {
+		if constexpr (ArenaTriviallyDestructible<T>::value) {
+			return new (this->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		} else {
+			// the destructor is registered in a header just before the object so the list of
+			// destructors never reallocates
+			constexpr size_t offset = (sizeof(Destructor) + alignof(T) - 1) & ~(alignof(T) - 1);
+			void *memory = this->allocate(offset + sizeof(T), std::max(alignof(Destructor), alignof(T)));
+			auto *object = new (static_cast<std::byte *>(memory) + offset) T(std::forward<Args>(args)...);
+			this->destructors = new (memory) Destructor{&destroy<T, offset>, this->destructors};
+			return object;
+		}
+	}
+
+	template <typename T>
+	T *allocateArray(size_t count) {
+		static_assert(std::is_trivially_destructible_v<T>,
+					  "arena arrays are never destroyed, they can't own resources");
+		return static_cast<T *>(this->allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	size_t getAllocatedBytes() const;
+
+  private:
+	struct Destructor {
+		void (*destroy)(Destructor *destructor);
+		Destructor *previous;
+	};
+
+	template <typename T, size_t offset>
+	static void destroy(Destructor *destructor) {
+		std::launder(reinterpret_cast<T *>(reinterpret_cast<std::byte *>(destructor) + offset))->~T();
+	}
+
+	size_t chunkSize;
+	std::vector<std::unique_ptr<std::byte[]>> chunks;
+	std::byte *current = nullptr;
+	size_t remaining = 0;
+	size_t allocatedBytes = 0;
+	Destructor *destructors = nullptr;
+};
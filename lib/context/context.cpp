@@ -1,19 +1,29 @@
 #include "context/context.hpp"
+#include "counters/counters.hpp"
+#include "value/types/variable.hpp"
+#include <utility>
 
 Context::Context(const Context &other)
 	: name(other.name), filePath(other.filePath), symbols(other.symbols), type(other.type),
-	  parent(other.parent), root(other.root) {}
+	  parent(other.parent), root(other.root) {
+	RPN_COUNT(CONTEXTS);
+}
 
 Context::Context(const Context *other)
 	: name(other->name), filePath(other->filePath), symbols(other->symbols), type(other->type),
-	  parent(other->parent), root(other->root) {}
+	  parent(other->parent), root(other->root) {
+	RPN_COUNT(CONTEXTS);
+}
 
 Context::Context(std::string_view name, std::string_view filePath, ContextType type)
-	: name(name), filePath(filePath), symbols(), type(type) {}
+	: name(name), filePath(filePath), symbols(), type(type) {
+	RPN_COUNT(CONTEXTS);
+}
 
 Context::Context(std::string_view name, std::string_view filePath, ContextPtr parent,
 				 ContextType type, bool root)
 	: name(name), filePath(filePath), symbols(), type(type), parent(parent) {
+	RPN_COUNT(CONTEXTS);
 	if (root)
 		return;
 	if (parent->root.use_count() > 0) {
@@ -25,11 +35,14 @@ Context::Context(std::string_view name, std::string_view filePath, ContextPtr pa
 
 Context::Context(std::string_view name, std::string_view filePath, symbolTable symbols,
 				 ContextType type)
-	: name(name), filePath(filePath), symbols(symbols), type(type) {}
+	: name(name), filePath(filePath), symbols(symbols), type(type) {
+	RPN_COUNT(CONTEXTS);
+}
 
 Context::Context(std::string_view name, std::string_view filePath, symbolTable symbols,
 				 ContextPtr parent, ContextType type, bool root)
 	: name(name), filePath(filePath), symbols(symbols), type(type), parent(parent) {
+	RPN_COUNT(CONTEXTS);
 	if (root)
 		return;
 	if (parent->root.use_count() > 0) {
@@ -45,7 +58,9 @@ Context::~Context() {
 
 void Context::clear() {
 	for (auto &[_, value] : this->symbols) {
-		if (value == nullptr || value->getOwner() != Value::CONTEXT_VARIABLE) {
+		// the variables of a builtin module are owned by the module
+		if (value == nullptr || (value->getOwner() != Value::CONTEXT_VARIABLE &&
+								 value->getOwner() != Value::MODULE)) {
 			continue;
 		}
 		delete value;
@@ -128,10 +143,13 @@ ContextPtr Context::getParent() const {
  * @param name the name of the value
  * @param value the value to set
  */
-void Context::setValue(const std::string &name, Value *value, Value **hold, bool takeOwnership) {
+void Context::setValue(Symbol name, Value *value, Value **hold, bool takeOwnership) {
 	value->setOwner(Value::CONTEXT_VARIABLE, takeOwnership);
-	if (this->symbols.contains(name)) {
-		Value **symbol = &this->symbols[name];
+	if (this->trackSymbols) {
+		this->touchedSymbols.insert(name);
+	}
+	if (auto it = this->symbols.find(name); it != this->symbols.end()) {
+		Value **symbol = &it->second;
 		if (*symbol != nullptr && (*symbol)->getOwner() == Value::CONTEXT_VARIABLE) {
 			if (hold)
 				*hold = *symbol;
@@ -144,39 +162,14 @@ void Context::setValue(const std::string &name, Value *value, Value **hold, bool
 }
 
 void Context::setValue(const Token *name, Value *value, Value **hold, bool takeOwnership) {
-	value->setOwner(Value::CONTEXT_VARIABLE, takeOwnership);
-	std::string nameStr = name->getStringValue();
-	if (this->symbols.contains(nameStr)) {
-		Value **symbol = &this->symbols[nameStr];
-		if (*symbol != nullptr && (*symbol)->getOwner() == Value::CONTEXT_VARIABLE) {
-			if (hold)
-				*hold = *symbol;
-			delete *symbol;
-		}
-		*symbol = value;
-	} else {
-		this->symbols[nameStr] = value;
-	}
+	this->setValue(name->getSymbol(), value, hold, takeOwnership);
 }
 
 void Context::setValue(const Value *name, Value *value, Value **hold, bool takeOwnership) {
 	if (name->getType() != VARIABLE)
 		throw std::runtime_error("Context::setValue() - name is not a variable");
 
-	value->setOwner(Value::CONTEXT_VARIABLE, takeOwnership);
-
-	std::string nameStr = name->getStringValue();
-	if (this->symbols.contains(nameStr)) {
-		Value **symbol = &this->symbols[nameStr];
-		if (*symbol != nullptr && (*symbol)->getOwner() == Value::CONTEXT_VARIABLE) {
-			if (hold)
-				*hold = *symbol;
-			delete *symbol;
-		}
-		*symbol = value;
-	} else {
-		this->symbols[nameStr] = value;
-	}
+	this->setValue(static_cast<const Variable *>(name)->getSymbol(), value, hold, takeOwnership);
 }
 
 /**
@@ -186,7 +179,8 @@ void Context::setValue(const Value *name, Value *value, Value **hold, bool takeO
  * @return bool if the value exits
  */
 bool Context::hasValue(std::string_view name) const {
-	return this->symbols.contains(name.data());
+	std::optional<Symbol> const symbol = Symbol::find(name);
+	return symbol.has_value() && this->symbols.contains(symbol.value());
 }
 
 /**
@@ -196,19 +190,23 @@ bool Context::hasValue(std::string_view name) const {
  * @return Value the desired value
  */
 Value *&Context::getValue(const Value *name) {
-	std::string nameStr = name->getStringValue();
-	if (this->symbols.contains(nameStr)) {
-		return this->symbols.at(nameStr);
-	}
-
-	if (this->root) {
-		return this->root->getValue(name);
+	RPN_COUNT(VARIABLE_LOOKUPS);
+	Symbol const symbol = static_cast<const Variable *>(name)->getSymbol();
+	// the root context has no root itself, the lookup never goes further
+	for (Context *context : {this, this->root.get()}) {
+		if (context == nullptr) {
+			break;
+		}
+		if (auto it = context->symbols.find(symbol); it != context->symbols.end()) {
+			return it->second;
+		}
 	}
 
-	throw std::runtime_error("Undefined variable name : " + nameStr);
+	throw std::runtime_error("Undefined variable name : " + symbol.name());
 }
 
-Value *&Context::getValue(const std::string &name) {
+Value *&Context::getValue(Symbol name) {
+	RPN_COUNT(VARIABLE_LOOKUPS);
 	return this->symbols.at(name);
 }
 
@@ -218,10 +216,39 @@ void Context::takeOwnership() {
 	}
 }
 
-void Context::copyTokenValues() {
-	for (auto &symbol : this->symbols) {
-		if (symbol.second->getOwner() == Value::VALUE_TOKEN) {
-			symbol.second = symbol.second->copy(Value::CONTEXT_VARIABLE);
+/**
+ * @brief record the symbols which are assigned, the shell uses them to update only what the last
+ * input changed
+ *
+ * @param track if the symbols should be recorded
+ */
+void Context::trackTouchedSymbols(bool track) {
+	this->trackSymbols = track;
+	this->touchedSymbols.clear();
+}
+
+/**
+ * @brief get the symbols assigned since the last call, each symbol appears once
+ *
+ * @return std::vector<Symbol> the assigned symbols
+ */
+std::vector<Symbol> Context::takeTouchedSymbols() {
+	std::vector<Symbol> touched(this->touchedSymbols.begin(), this->touchedSymbols.end());
+	this->touchedSymbols.clear();
+	return touched;
+}
+
+/**
+ * @brief copy the values of the given symbols which are still owned by a token so they don't
+ * depend on the code which created them
+ *
+ * @param symbols the symbols to check, usually the touched symbols
+ */
+void Context::copyTokenValues(const std::vector<Symbol> &symbols) {
+	for (Symbol const symbol : symbols) {
+		auto it = this->symbols.find(symbol);
+		if (it != this->symbols.end() && it->second->getOwner() == Value::VALUE_TOKEN) {
+			it->second = it->second->copy(Value::CONTEXT_VARIABLE);
 		}
 	}
 }
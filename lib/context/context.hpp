@@ -3,7 +3,7 @@
 #include "context/contexttypes.hpp"
 #include "context/typedef.hpp"
 #include "expressionresult/expressionresult.hpp"
-#include "textutilities/stringhash.hpp"
+#include "textutilities/symbol.hpp"
 #include "tokens/token.hpp"
 #include "value/value.hpp"
 #include <memory>
@@ -11,9 +11,11 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 class Value;
-using symbolTable = std::unordered_map<std::string, Value *, StringHash, std::equal_to<>>;
+using symbolTable = std::unordered_map<Symbol, Value *, SymbolHash>;
 
 class Context : public std::enable_shared_from_this<Context> {
   public:
@@ -44,19 +46,20 @@ class Context : public std::enable_shared_from_this<Context> {
 	ContextPtr getParent() const;
 	ContextType getType() const;
 
-	void setValue(const std::string &name, Value *value, Value **hold = nullptr,
-				  bool takeOwnership = false);
+	void setValue(Symbol name, Value *value, Value **hold = nullptr, bool takeOwnership = false);
 	void setValue(const Token *name, Value *value, Value **hold = nullptr,
 				  bool takeOwnership = false);
 	void setValue(const Value *name, Value *value, Value **hold = nullptr,
 				  bool takeOwnership = false);
 
 	Value *&getValue(const Value *name);
-	Value *&getValue(const std::string &name);
+	Value *&getValue(Symbol name);
 
 	bool hasValue(std::string_view name) const;
 	void takeOwnership();
-	void copyTokenValues();
+	void trackTouchedSymbols(bool track);
+	std::vector<Symbol> takeTouchedSymbols();
+	void copyTokenValues(const std::vector<Symbol> &symbols);
 
 	bool hasParentType(ContextType type) const;
 
@@ -67,6 +70,10 @@ class Context : public std::enable_shared_from_this<Context> {
 	ContextType type;
 	ContextPtr parent;
 	ContextPtr root;
+	// symbols assigned since the last takeTouchedSymbols, only recorded for the shell. A symbol
+	// assigned in a loop is only recorded once
+	bool trackSymbols = false;
+	std::unordered_set<Symbol, SymbolHash> touchedSymbols;
 };
 
 std::ostream &operator<<(std::ostream &os, const ContextPtr &context);
\ No newline at end of file
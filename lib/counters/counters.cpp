@@ -0,0 +1,65 @@
+#include "counters/counters.hpp"
+
+#ifdef RPN_COUNTERS
+
+#include <string_view>
+
+namespace counters {
+std::atomic<uint64_t> counts[COUNTER_COUNT];
+std::atomic<uint64_t> operators[operatorCount][typeCount][typeCount];
+std::atomic<uint64_t> allocations[typeCount];
+
+namespace {
+constexpr std::string_view counterNames[COUNTER_COUNT] = {
+	"tokens", "variableLookups", "functionCalls", "contexts", "moduleLookups"};
+
+// stringType only knows the types which can be written in a program
+constexpr std::string_view typeNames[typeCount] = {
+	"INT", "FLOAT", "STRING", "VARIABLE", "BUILTIN_VARIABLE", "FUNCTION", "BOOL", "PATH",
+	"BUILTIN_PATH", "STRUCT_ACCESS", "LIST", "LIST_ELEMENT", "STRUCT", "ANY", "NONE"};
+} // namespace
+
+/**
+ * @brief write the counters as a JSON object, the operators and the allocations which never
+ * happened are left out
+ *
+ * @param stream the stream to write the counters in
+ */
+void write(std::ostream &stream) {
+	stream << "{\n";
+	for (size_t counter = 0; counter < COUNTER_COUNT; counter++) {
+		stream << "\t\"" << counterNames[counter] << "\": " << counts[counter] << ",\n";
+	}
+
+	stream << "\t\"operators\": {";
+	const char *separator = "\n";
+	for (size_t op = 0; op < operatorCount; op++) {
+		for (size_t left = 0; left < typeCount; left++) {
+			for (size_t right = 0; right < typeCount; right++) {
+				if (operators[op][left][right] == 0) {
+					continue;
+				}
+				const auto type = static_cast<OperatorToken::OperatorTypes>(op);
+				stream << separator << "\t\t\"" << typeNames[left] << " "
+					   << OperatorToken::operatorString(type) << " " << typeNames[right]
+					   << "\": " << operators[op][left][right];
+				separator = ",\n";
+			}
+		}
+	}
+	stream << "\n\t},\n";
+
+	stream << "\t\"allocations\": {";
+	separator = "\n";
+	for (size_t type = 0; type < typeCount; type++) {
+		if (allocations[type] == 0) {
+			continue;
+		}
+		stream << separator << "\t\t\"" << typeNames[type] << "\": " << allocations[type];
+		separator = ",\n";
+	}
+	stream << "\n\t}\n}\n";
+}
+} // namespace counters
+
+#endif
@@ -0,0 +1,52 @@
+#pragma once
+
+/**
+ * @brief exact counts of the operations done by the interpreter, they don't depend on the machine
+ * so two builds can be compared to find small regressions. The counters only exist when the
+ * interpreter is configured with -DRPN_COUNTERS=ON, otherwise the RPN_COUNT macros expand to
+ * nothing
+ */
+#ifdef RPN_COUNTERS
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+#include "tokens/tokens/operatortoken.hpp"
+#include "value/valuetypes.hpp"
+
+namespace counters {
+enum Counter {
+	TOKENS,
+	VARIABLE_LOOKUPS,
+	FUNCTION_CALLS,
+	CONTEXTS,
+	MODULE_LOOKUPS,
+	COUNTER_COUNT
+};
+
+constexpr size_t operatorCount = OperatorToken::OP_VDIV + 1;
+constexpr size_t typeCount = NONE + 1;
+
+// the values of the tokens are created on the thread pool when a file is lexed
+extern std::atomic<uint64_t> counts[COUNTER_COUNT];
+extern std::atomic<uint64_t> operators[operatorCount][typeCount][typeCount];
+extern std::atomic<uint64_t> allocations[typeCount];
+
+void write(std::ostream &stream);
+} // namespace counters
+
+#define RPN_COUNT(counter)                                                                         \
+	counters::counts[counters::counter].fetch_add(1, std::memory_order_relaxed)
+#define RPN_COUNT_OPERATOR(op, left, right)                                                        \
+	counters::operators[op][left][right].fetch_add(1, std::memory_order_relaxed)
+#define RPN_COUNT_ALLOCATION(type)                                                                 \
+	counters::allocations[type].fetch_add(1, std::memory_order_relaxed)
+
+#else
+
+#define RPN_COUNT(counter)
+#define RPN_COUNT_OPERATOR(op, left, right)
+#define RPN_COUNT_ALLOCATION(type)
+
+#endif
@@ -1,7 +1,22 @@
 #include "cppmodule/cppmodule.hpp"
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "trace/phases.hpp"
+#include "trace/tracer.hpp"
+#include "value/types/numbers/bool.hpp"
+#include "value/types/numbers/float.hpp"
+#include "value/types/numbers/int.hpp"
+#include "value/types/string.hpp"
+#include "value/types/struct.hpp"
+
 std::unordered_map<std::string, BuiltinRPNFunction> CppModule::moduleFunctions =
 	std::unordered_map<std::string, BuiltinRPNFunction>();
+std::deque<BuiltinRPNFunction> CppModule::manifestFunctions;
+std::unordered_map<std::string, ModuleAPI *> CppModule::staticModules;
 std::string CppModule::builtinModulesPath = "";
 unsigned int CppModule::openModulesCount = 0;
 
@@ -25,21 +40,66 @@ CppModule::~CppModule() {
 }
 
 /**
- * @brief load the module if it hasn't been loaded yet
+ * @brief import the module, from its manifest if it is up to date or by opening its library
  *
  * @return ExpressionResult the result of the load operation
  */
 ExpressionResult CppModule::load(TextRange imortRange) {
+	const Tracer::Span span("import", this->name);
+	if (!CppModule::staticModules.contains(this->name)) {
+		const Phases::Scope phase("manifest", this->name);
+		if (this->loadManifest()) {
+			return ExpressionResult();
+		}
+	}
+	return this->open(imortRange);
+}
+
+/**
+ * @brief run the loader of the module if it hasn't been done yet, the library of the module is
+ * opened unless the module is compiled in the interpreter
+ *
+ * @return ExpressionResult the result of the load operation
+ */
+ExpressionResult CppModule::open(TextRange imortRange) {
+	if (this->api) {
+		return ExpressionResult();
+	}
+	if (auto staticModule = CppModule::staticModules.find(this->name);
+		staticModule != CppModule::staticModules.end()) {
+		this->api = staticModule->second;
+	} else if (ExpressionResult result = this->openLibrary(imortRange); result.error()) {
+		return result;
+	}
+	{
+		const Phases::Scope phase("loader", this->name);
+		this->api->loader(this);
+	}
+	this->addVariable("author", new String(this->api->author, TextRange(), Value::MODULE));
+	this->addVariable("version", new String(this->api->version, TextRange(), Value::MODULE));
+	this->addVariable("description",
+					  new String(this->api->description, TextRange(), Value::MODULE));
+	this->addVariable("name", new String(this->api->name, TextRange(), Value::MODULE));
+	return ExpressionResult();
+}
+
+/**
+ * @brief open the shared library of the module and find its API
+ *
+ * @return ExpressionResult the result of the load operation
+ */
+ExpressionResult CppModule::openLibrary(TextRange imortRange) {
+	const Tracer::Span span("import", "dlopen " + this->name);
+	const Phases::Scope phase("dlopen", this->name);
 	CppModule::openModulesCount++;
-	this->handle =
-		dlopen((CppModule::builtinModulesPath + "/lib" + name + ".so").c_str(), RTLD_LAZY);
+	this->handle = dlopen(this->getLibraryPath().c_str(), RTLD_LAZY);
 	if (!this->handle) {
 		return ExpressionResult("Error while loading module " + name + ": " + dlerror(), imortRange,
 								this->context);
 	}
 	dlerror();
 
-	ModuleAPI *api = (ModuleAPI *)dlsym(this->handle, "moduleAPI");
+	auto *api = (ModuleAPI *)dlsym(this->handle, "moduleAPI");
 	const char *dlsym_error = dlerror();
 	if (dlsym_error) {
 		return ExpressionResult("Error while loading module " + name + ": " + dlsym_error,
@@ -49,14 +109,96 @@ ExpressionResult CppModule::load(TextRange imortRange) {
 		return ExpressionResult("Error while loading module " + name + ": moduleAPI is null",
 								imortRange, this->context);
 	}
-	api->loader(this);
-	this->addVariable("author", new String(api->author, TextRange(), Value::MODULE));
-	this->addVariable("version", new String(api->version, TextRange(), Value::MODULE));
-	this->addVariable("description", new String(api->description, TextRange(), Value::MODULE));
-	this->addVariable("name", new String(api->name, TextRange(), Value::MODULE));
+	this->api = api;
 	return ExpressionResult();
 }
 
+/**
+ * @brief write the manifest of an opened module next to its library. The structs used by the
+ * function signatures are described with their members so they are defined when the module is
+ * imported from the manifest. Modules which define other values than numbers, booleans and
+ * strings have no manifest, they are always opened when they are imported
+ *
+ * @return bool true if the manifest has been written
+ */
+bool CppModule::writeManifest() const {
+	std::ostringstream manifest;
+	manifest << "RPNmodule " << this->getLibraryStamp() << "\n";
+	std::vector<std::string> structs;
+	bool valid = true;
+	auto writeBaseType = [&manifest, &structs, &valid](const RPNBaseType &type) {
+		if (std::holds_alternative<ValueType>(type)) {
+			manifest << " " << stringType(std::get<ValueType>(type));
+			return;
+		}
+		const std::string &structName = std::get<std::string>(type);
+		valid &= Struct::structExists(structName);
+		if (std::find(structs.begin(), structs.end(), structName) == structs.end()) {
+			structs.push_back(structName);
+		}
+		manifest << " struct:" << structName;
+	};
+	auto writeType = [&writeBaseType](const RPNValueType &type) {
+		writeBaseType(type.getType());
+		writeBaseType(type.getListType());
+	};
+	for (const auto &[symbol, value] : this->context->getSymbols()) {
+		switch (value->getType()) {
+			case FUNCTION: {
+				const RPNFunction *function = static_cast<const Function *>(value)->getValue();
+				const RPNFunctionArgs arguments = function->getArgs();
+				manifest << "function " << symbol.name();
+				writeType(function->getReturnType());
+				manifest << " " << arguments.size();
+				for (const auto &[argumentName, argumentType] : arguments) {
+					manifest << " " << argumentName;
+					writeType(argumentType);
+				}
+				break;
+			}
+			case INT:
+				manifest << "value " << symbol.name() << " int "
+						 << static_cast<const Int *>(value)->getValue();
+				break;
+			case FLOAT:
+				manifest << "value " << symbol.name() << " float " << std::hexfloat
+						 << static_cast<const Float *>(value)->getValue() << std::defaultfloat;
+				break;
+			case BOOL:
+				manifest << "value " << symbol.name() << " bool "
+						 << static_cast<const Bool *>(value)->getValue();
+				break;
+			case STRING: {
+				const std::string text = value->getStringValue();
+				manifest << "value " << symbol.name() << " string " << text.size() << " " << text;
+				break;
+			}
+			default:
+				valid = false;
+		}
+		manifest << "\n";
+	}
+	// the members can use other structs which are appended to the list while it is written
+	for (size_t i = 0; i < structs.size() && valid; i++) {
+		const StructDefinition &definition = Struct::getStructDefinition(structs[i]);
+		manifest << "struct " << structs[i] << " " << definition.getMembersCount();
+		for (const std::string &member : definition.getMembersOrder()) {
+			manifest << " " << member;
+			writeType(definition.getMemberType(member));
+		}
+		manifest << "\n";
+	}
+
+	std::error_code error;
+	if (!valid) {
+		std::filesystem::remove(this->getManifestPath(), error);
+		return false;
+	}
+	std::ofstream file(this->getManifestPath(), std::ios::trunc);
+	file << manifest.str();
+	return file.good();
+}
+
 /**
  * @brief add a function to the module context
  *
@@ -68,6 +210,11 @@ ExpressionResult CppModule::load(TextRange imortRange) {
  */
 void CppModule::addFunction(const std::string &name, const RPNFunctionArgs &arguments,
 							RPNValueType returnType, BuiltinRPNFunctionType function) {
+	if (auto lazyFunction = this->lazyFunctions.find(name);
+		lazyFunction != this->lazyFunctions.end()) {
+		*lazyFunction->second = std::move(function);
+		return;
+	}
 	this->moduleFunctions.insert(
 		this->moduleFunctions.begin(),
 		std::pair<std::string, BuiltinRPNFunction>(
@@ -83,6 +230,11 @@ void CppModule::addFunction(const std::string &name, const RPNFunctionArgs &argu
  * @param value the value of the variable
  */
 void CppModule::addVariable(const std::string &name, Value *value) {
+	// the value read from the manifest may already be used by the program
+	if (this->fromManifest && this->context->hasValue(name)) {
+		delete value;
+		return;
+	}
 	context->setValue(name, value);
 }
 
@@ -98,7 +250,8 @@ ContextPtr CppModule::getModuleContext() {
  * @return false if the module is not builtin
  */
 bool CppModule::isBuiltin(const std::string &name) {
-	return std::filesystem::exists(CppModule::builtinModulesPath + "/lib" + name + ".so");
+	return CppModule::staticModules.contains(name) ||
+		   std::filesystem::exists(CppModule::builtinModulesPath + "/lib" + name + ".so");
 }
 
 /**
@@ -108,4 +261,141 @@ bool CppModule::isBuiltin(const std::string &name) {
  */
 void CppModule::setBuiltinModulesPath(const std::string &path) {
 	CppModule::builtinModulesPath = path;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief register a module compiled in the interpreter, it is used instead of the library with
+ * the same name
+ *
+ * @param name the name of the module
+ * @param api the API of the module
+ */
+void CppModule::addStaticModule(const std::string &name, ModuleAPI *api) {
+	CppModule::staticModules[name] = api;
+}
+/**
+ * @brief import the module from its manifest: the values are created from the manifest and each
+ * function is a stub which opens the library when it is called. The manifest is ignored if it
+ * wasn't written for the current library
+ *
+ * @return bool true if the module has been imported from its manifest
+ */
+bool CppModule::loadManifest() {
+	std::ifstream file(this->getManifestPath());
+	std::string header;
+	std::string stamp;
+	if (!(file >> header >> stamp) || header != "RPNmodule" || stamp != this->getLibraryStamp()) {
+		return false;
+	}
+	auto readBaseType = [&file]() -> RPNBaseType {
+		std::string type;
+		file >> type;
+		if (type.starts_with("struct:")) {
+			return type.substr(7);
+		}
+		return stringToType(type);
+	};
+	auto readType = [&readBaseType]() {
+		const RPNBaseType type = readBaseType();
+		return RPNValueType(type, readBaseType());
+	};
+
+	std::string kind;
+	std::string name;
+	while (file >> kind >> name) {
+		if (kind == "struct") {
+			size_t count = 0;
+			file >> count;
+			StructDefinition definition(name);
+			for (size_t i = 0; i < count; i++) {
+				std::string member;
+				file >> member;
+				definition.addMember(member, readType());
+			}
+			Struct::addStructDefinition(definition);
+			continue;
+		}
+		if (kind == "function") {
+			const RPNValueType returnType = readType();
+			size_t count = 0;
+			file >> count;
+			RPNFunctionArgs arguments(count);
+			for (auto &[argumentName, argumentType] : arguments) {
+				file >> argumentName;
+				argumentType = readType();
+			}
+			auto implementation = std::make_shared<BuiltinRPNFunctionType>();
+			this->lazyFunctions[name] = implementation;
+			const BuiltinRPNFunction &stub = CppModule::manifestFunctions.emplace_back(
+				name, arguments, returnType,
+				[this, implementation, functionName = name](
+					RPNFunctionArgsValue &args, TextRange &range,
+					ContextPtr context) -> RPNFunctionResult {
+					if (!*implementation) {
+						if (ExpressionResult result = this->open(range); result.error()) {
+							return result;
+						}
+					}
+					if (!*implementation) {
+						return ExpressionResult(
+							"Module " + this->name + " doesn't define " + functionName, range,
+							context);
+					}
+					return (*implementation)(args, range, context);
+				});
+			this->context->setValue(name, new Function(&stub, TextRange(), Value::CONTEXT_VARIABLE));
+			continue;
+		}
+
+		std::string type;
+		file >> type;
+		Value *value = nullptr;
+		if (type == "int") {
+			int64_t number = 0;
+			file >> number;
+			value = new Int(number, TextRange(), Value::MODULE);
+		} else if (type == "float") {
+			std::string number;
+			file >> number;
+			value = new Float(std::strtof(number.c_str(), nullptr), TextRange(), Value::MODULE);
+		} else if (type == "bool") {
+			bool boolean = false;
+			file >> boolean;
+			value = new Bool(boolean, TextRange(), Value::MODULE);
+		} else {
+			size_t size = 0;
+			file >> size;
+			file.get();
+			std::string text(size, '\0');
+			file.read(text.data(), static_cast<std::streamsize>(size));
+			value = new String(text, TextRange(), Value::MODULE);
+		}
+		this->context->setValue(name, value);
+	}
+	this->fromManifest = true;
+	return true;
+}
+
+std::string CppModule::getLibraryPath() const {
+	return CppModule::builtinModulesPath + "/lib" + this->name + ".so";
+}
+
+std::string CppModule::getManifestPath() const {
+	return CppModule::builtinModulesPath + "/lib" + this->name + ".manifest";
+}
+
+/**
+ * @brief identify the build of the library, a manifest is only valid for the library it was
+ * written from
+ *
+ * @return std::string the size and the modification time of the library
+ */
+std::string CppModule::getLibraryStamp() const {
+	std::error_code error;
+	const auto size = std::filesystem::file_size(this->getLibraryPath(), error);
+	const auto time = std::filesystem::last_write_time(this->getLibraryPath(), error);
+	if (error) {
+		return "none";
+	}
+	return std::to_string(size) + "-" + std::to_string(time.time_since_epoch().count());
+}
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <deque>
 #include <dlfcn.h>
 #include <functional>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -27,6 +29,12 @@ struct ModuleAPI {
 	loadFunction loader;
 };
 
+/**
+ * @brief a module written in C++, compiled in the interpreter or loaded from a shared library.
+ * When the library has an up to date manifest, the module is imported from the manifest: its
+ * functions are stubs which open the library the first time one of them is called and its values
+ * are read from the manifest
+ */
 class CppModule {
   public:
 	CppModule();
@@ -34,6 +42,8 @@ class CppModule {
 	~CppModule();
 
 	ExpressionResult load(TextRange imortRange);
+	ExpressionResult open(TextRange imortRange);
+	bool writeManifest() const;
 
 	void addFunction(const std::string &name, const RPNFunctionArgs &arguments,
 					 RPNValueType returnType, BuiltinRPNFunctionType function);
@@ -42,13 +52,29 @@ class CppModule {
 	ContextPtr getModuleContext();
 	static bool isBuiltin(const std::string &name);
 	static void setBuiltinModulesPath(const std::string &path);
+	static void addStaticModule(const std::string &name, ModuleAPI *api);
+	// defined by the build with the modules selected by RPN_STATIC_MODULES
+	static void registerStaticModules();
 
   private:
+	ExpressionResult openLibrary(TextRange imortRange);
+	bool loadManifest();
+	std::string getLibraryPath() const;
+	std::string getManifestPath() const;
+	std::string getLibraryStamp() const;
+
 	std::string name;
 	ContextPtr context;
 	void *handle;
+	ModuleAPI *api = nullptr;
+	bool fromManifest = false;
+	// implementations of the functions declared by the manifest, filled when the library is opened
+	std::unordered_map<std::string, std::shared_ptr<BuiltinRPNFunctionType>> lazyFunctions;
 
 	static unsigned int openModulesCount;
 	static std::string builtinModulesPath;
 	static std::unordered_map<std::string, BuiltinRPNFunction> moduleFunctions;
+	static std::unordered_map<std::string, ModuleAPI *> staticModules;
+	// a deque so the functions referenced by the module contexts never move
+	static std::deque<BuiltinRPNFunction> manifestFunctions;
 };
\ No newline at end of file
@@ -121,6 +121,15 @@ void ExpressionResult::display() {
 		std::cout << "Invoked from " << this->context->getTypeName() << std::endl;
 	}
 
+	if (const SourceFile *source = SourceFile::find(this->context->getFilePath());
+		source != nullptr) {
+		std::cout << "At line " << range.line << " and column " << range.columnStart << " :"
+				  << std::endl;
+		std::cout << source->getLine(range.line) << std::endl;
+		this->displayArrow(range, source->getLine(range.line));
+		return;
+	}
+
 	std::ifstream file;
 	std::string errorMessage;
 	if (!openFile(file, this->context->getFilePath(), errorMessage)) {
@@ -146,7 +155,7 @@ void ExpressionResult::display() {
 
 void ExpressionResult::displayArrow(TextRange range, std::string_view lineString) const {
 	for (long unsigned int i = 1; i <= range.columnEnd; i++) {
-		if (lineString[i - 1] == '\t') {
+		if (i <= lineString.size() && lineString[i - 1] == '\t') {
 			std::cout << "\t";
 		} else if (i < range.columnStart) {
 			std::cout << " ";
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "context/context.hpp"
+#include "textutilities/sourcefile.hpp"
 #include "textutilities/textrange.hpp"
 #include <fstream>
 #include <iostream>
@@ -3,8 +3,9 @@
 BuiltinRPNFunction::BuiltinRPNFunction() : RPNFunction("", {}, NONE), function(nullptr) {}
 
 BuiltinRPNFunction::BuiltinRPNFunction(std::string_view name, RPNFunctionArgs arguments,
-									   RPNValueType returnType, BuiltinRPNFunctionType function)
-	: RPNFunction(name, arguments, returnType), function(function) {
+									   RPNValueType returnType, BuiltinRPNFunctionType function,
+									   ReturnRule returnRule)
+	: RPNFunction(name, arguments, returnType, returnRule), function(function) {
 	if (this->function == nullptr) {
 		throw std::invalid_argument("BuiltinRPNFunction::BuiltinRPNFunction: function is nullptr");
 	}
@@ -2,6 +2,7 @@
 
 #include "rpnfunctions/rpnfunction.hpp"
 #include "rpnfunctions/typedef.hpp"
+#include "textutilities/symbol.hpp"
 #include "value/value.hpp"
 #include "value/valuetypes.hpp"
 #include <cassert>
@@ -16,14 +17,13 @@ class BuiltinRPNFunction : public RPNFunction {
   public:
 	BuiltinRPNFunction();
 	BuiltinRPNFunction(std::string_view name, RPNFunctionArgs arguments, RPNValueType returnType,
-					   BuiltinRPNFunctionType function);
+					   BuiltinRPNFunctionType function,
+					   ReturnRule returnRule = ReturnRule::DECLARED);
 	~BuiltinRPNFunction() override = default;
 
 	RPNFunctionResult call(RPNFunctionArgsValue &args, const TextRange &range,
 						   ContextPtr context) const override;
 
-	static const std::unordered_map<std::string, BuiltinRPNFunction> builtinFunctions;
-
   private:
 	BuiltinRPNFunctionType function;
 };
\ No newline at end of file
@@ -0,0 +1,25 @@
+#include "rpnfunctions/functionsignature.hpp"
+
+/**
+ * @brief get the type of the value returned for the given argument types
+ *
+ * @param argumentTypes the types of the arguments, in the order of the signature
+ * @return RPNValueType the return type for these arguments
+ */
+RPNValueType
+FunctionSignature::resolveReturnType(const std::vector<RPNValueType> &argumentTypes) const {
+	if (this->returnRule == ReturnRule::DECLARED) {
+		return this->returnType;
+	}
+	for (const RPNValueType &type : argumentTypes) {
+		if (type.index() != 1 || std::get<ValueType>(type.getType()) != LIST) {
+			continue;
+		}
+		const RPNBaseType listType = type.getListType();
+		if (listType.index() != 1 ||
+			(std::get<ValueType>(listType) != INT && std::get<ValueType>(listType) != BOOL)) {
+			return this->returnType;
+		}
+	}
+	return INT;
+}
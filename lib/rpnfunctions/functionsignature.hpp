@@ -1,11 +1,25 @@
 #pragma once
 
 #include "rpnfunctions/typedef.hpp"
+#include <cstdint>
 #include <vector>
 
+/**
+ * @brief how the return type of a function is deduced from the types of its arguments
+ */
+enum class ReturnRule : uint8_t {
+	// always the declared return type
+	DECLARED,
+	// int when every list argument is declared to hold integers, the declared type otherwise
+	LIST_ELEMENTS
+};
+
 struct FunctionSignature {
 	std::vector<RPNValueType> args;
 	RPNValueType returnType;
 	bool builtin;
 	bool callable = true;
+	ReturnRule returnRule = ReturnRule::DECLARED;
+
+	RPNValueType resolveReturnType(const std::vector<RPNValueType> &argumentTypes) const;
 };
\ No newline at end of file
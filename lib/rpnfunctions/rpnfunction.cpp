@@ -1,8 +1,8 @@
 #include "rpnfunctions/rpnfunction.hpp"
 
 RPNFunction::RPNFunction(std::string_view name, const RPNFunctionArgs &arguments,
-						 const RPNValueType &returnType)
-	: name(name), arguments(arguments), returnType(returnType) {
+						 const RPNValueType &returnType, ReturnRule returnRule)
+	: name(name), arguments(arguments), returnType(returnType), returnRule(returnRule) {
 	if (returnType.index() == 1 && std::get<ValueType>(returnType.getType()) == ANY) {
 		throw std::runtime_error("Function return type cannot be ANY");
 	}
@@ -56,5 +56,5 @@ FunctionSignature RPNFunction::getSignature() const {
 	for (const auto &[_, type] : this->arguments) {
 		args.push_back(type);
 	}
-	return FunctionSignature{args, this->returnType, false, true};
+	return FunctionSignature{args, this->returnType, false, true, this->returnRule};
 }
@@ -14,7 +14,7 @@
 class RPNFunction {
   public:
 	RPNFunction(std::string_view name, const RPNFunctionArgs &arguments,
-				const RPNValueType &returnType);
+				const RPNValueType &returnType, ReturnRule returnRule = ReturnRule::DECLARED);
 	virtual ~RPNFunction();
 
 	virtual RPNFunctionResult call(RPNFunctionArgsValue &args, const TextRange &range,
@@ -33,6 +33,7 @@ class RPNFunction {
 	std::string name;
 	RPNFunctionArgs arguments;
 	RPNValueType returnType;
+	ReturnRule returnRule;
 };
 
 std::ostream &operator<<(std::ostream &os, const RPNFunction &function);
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "value/valuetypes.hpp"
+
+/**
+ * @brief statistics kept for the whole run and read by the runtime module. They are updated by
+ * the interpreter and by the native modules, the values of the tokens are also created on the
+ * thread pool when a file is lexed. The values are counted on every creation so each thread has
+ * its own counters, only written by it without a locked instruction, they are summed when read
+ */
+class RuntimeStats {
+  public:
+	struct ThreadCounters {
+		std::atomic<int64_t> liveValues[NONE + 1]{};
+		std::atomic<uint64_t> createdValues = 0;
+	};
+
+	std::atomic<uint64_t> cacheHits = 0;
+	std::atomic<uint64_t> cacheMisses = 0;
+	// the calls of the user functions by name, the functions with the same name share a counter
+	std::mutex functionsMutex;
+	std::unordered_map<std::string, std::atomic<uint64_t>> functionCalls;
+	// the counters of the threads which created or destroyed values, they are never removed
+	std::mutex threadsMutex;
+	std::deque<ThreadCounters> threads;
+
+	/**
+	 * @brief the instance is exported by the interpreter like the symbol table, so the native
+	 * modules update the same statistics. It is never destroyed because the values destroyed at
+	 * exit still update it
+	 */
+	static RuntimeStats &get() {
+		static RuntimeStats &stats = *new RuntimeStats();
+		return stats;
+	}
+
+	/**
+	 * @brief the counters of the calling thread, they are registered the first time the thread
+	 * uses them
+	 */
+	static ThreadCounters &local() {
+		thread_local ThreadCounters *counters = [] {
+			RuntimeStats &stats = RuntimeStats::get();
+			std::lock_guard<std::mutex> const lock(stats.threadsMutex);
+			return &stats.threads.emplace_back();
+		}();
+		return *counters;
+	}
+
+	/**
+	 * @brief change a counter of the calling thread, the other threads only read it
+	 */
+	template <typename T> static void add(std::atomic<T> &counter, T value) {
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	static void valueCreated(ValueType type) {
+		ThreadCounters &counters = RuntimeStats::local();
+		RuntimeStats::add<int64_t>(counters.liveValues[type], 1);
+		RuntimeStats::add<uint64_t>(counters.createdValues, 1);
+	}
+
+	static void valueDestroyed(ValueType type) {
+		RuntimeStats::add<int64_t>(RuntimeStats::local().liveValues[type], -1);
+	}
+
+	static void valueRetyped(ValueType from, ValueType to) {
+		ThreadCounters &counters = RuntimeStats::local();
+		RuntimeStats::add<int64_t>(counters.liveValues[from], -1);
+		RuntimeStats::add<int64_t>(counters.liveValues[to], 1);
+	}
+
+	/**
+	 * @brief the number of values of a type alive, a value can be destroyed by another thread than
+	 * the one which created it so only the sum of the threads is meaningful
+	 */
+	int64_t getLiveValues(ValueType type) {
+		std::lock_guard<std::mutex> const lock(this->threadsMutex);
+		int64_t live = 0;
+		for (const ThreadCounters &counters : this->threads) {
+			live += counters.liveValues[type].load(std::memory_order_relaxed);
+		}
+		return live;
+	}
+
+	uint64_t getCreatedValues() {
+		std::lock_guard<std::mutex> const lock(this->threadsMutex);
+		uint64_t created = 0;
+		for (const ThreadCounters &counters : this->threads) {
+			created += counters.createdValues.load(std::memory_order_relaxed);
+		}
+		return created;
+	}
+
+	/**
+	 * @brief get the call counter of a function, the counters are never removed so a function can
+	 * keep it
+	 */
+	static std::atomic<uint64_t> *functionCounter(const std::string &name) {
+		RuntimeStats &stats = RuntimeStats::get();
+		std::lock_guard<std::mutex> const lock(stats.functionsMutex);
+		return &stats.functionCalls[name];
+	}
+
+	static bool getFunctionCalls(const std::string &name, uint64_t &calls) {
+		RuntimeStats &stats = RuntimeStats::get();
+		std::lock_guard<std::mutex> const lock(stats.functionsMutex);
+		const auto counter = stats.functionCalls.find(name);
+		if (counter == stats.functionCalls.end()) {
+			return false;
+		}
+		calls = counter->second;
+		return true;
+	}
+
+	static void cacheLookup(bool hit) {
+		(hit ? RuntimeStats::get().cacheHits : RuntimeStats::get().cacheMisses)
+			.fetch_add(1, std::memory_order_relaxed);
+	}
+};
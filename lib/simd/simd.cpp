@@ -0,0 +1,422 @@
+#include "simd/simd.hpp"
+
+#include <type_traits>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace {
+simd::InstructionSet detectInstructionSet() {
+#if defined(__x86_64__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		return simd::AVX2;
+	}
+	// SSE2 is part of the x86_64 baseline
+	return simd::SSE2;
+#else
+	return simd::SCALAR;
+#endif
+}
+
+template <simd::Operation op, typename T> inline T applyOne(T left, T right) {
+	if constexpr (op == simd::ADD) {
+		return left + right;
+	} else if constexpr (op == simd::SUB) {
+		return left - right;
+	} else if constexpr (op == simd::MUL) {
+		return left * right;
+	} else {
+		return left / right;
+	}
+}
+
+template <simd::Operation op, typename T>
+void applyScalar(const T *left, const T *right, T *out, size_t size) {
+	for (size_t i = 0; i < size; i++) {
+		out[i] = applyOne<op>(left[i], right[i]);
+	}
+}
+
+template <typename T> T sumScalar(const T *values, size_t size) {
+	T result = 0;
+	for (size_t i = 0; i < size; i++) {
+		result += values[i];
+	}
+	return result;
+}
+
+template <typename T> T minScalar(const T *values, size_t size, T result) {
+	for (size_t i = 0; i < size; i++) {
+		result = values[i] < result ? values[i] : result;
+	}
+	return result;
+}
+
+template <typename T> T maxScalar(const T *values, size_t size, T result) {
+	for (size_t i = 0; i < size; i++) {
+		result = values[i] > result ? values[i] : result;
+	}
+	return result;
+}
+
+template <typename T> T dotScalar(const T *left, const T *right, size_t size) {
+	T result = 0;
+	for (size_t i = 0; i < size; i++) {
+		result += left[i] * right[i];
+	}
+	return result;
+}
+
+#if defined(__x86_64__)
+template <simd::Operation op>
+void applySSE2(const float *left, const float *right, float *out, size_t size) {
+	size_t i = 0;
+	for (; i + 4 <= size; i += 4) {
+		__m128 const a = _mm_loadu_ps(left + i);
+		__m128 const b = _mm_loadu_ps(right + i);
+		if constexpr (op == simd::ADD) {
+			_mm_storeu_ps(out + i, _mm_add_ps(a, b));
+		} else if constexpr (op == simd::SUB) {
+			_mm_storeu_ps(out + i, _mm_sub_ps(a, b));
+		} else if constexpr (op == simd::MUL) {
+			_mm_storeu_ps(out + i, _mm_mul_ps(a, b));
+		} else {
+			_mm_storeu_ps(out + i, _mm_div_ps(a, b));
+		}
+	}
+	applyScalar<op>(left + i, right + i, out + i, size - i);
+}
+
+template <simd::Operation op>
+__attribute__((target("avx2"))) void applyAVX2(const float *left, const float *right,
+												float *out, size_t size) {
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8) {
+		__m256 const a = _mm256_loadu_ps(left + i);
+		__m256 const b = _mm256_loadu_ps(right + i);
+		if constexpr (op == simd::ADD) {
+			_mm256_storeu_ps(out + i, _mm256_add_ps(a, b));
+		} else if constexpr (op == simd::SUB) {
+			_mm256_storeu_ps(out + i, _mm256_sub_ps(a, b));
+		} else if constexpr (op == simd::MUL) {
+			_mm256_storeu_ps(out + i, _mm256_mul_ps(a, b));
+		} else {
+			_mm256_storeu_ps(out + i, _mm256_div_ps(a, b));
+		}
+	}
+	applyScalar<op>(left + i, right + i, out + i, size - i);
+}
+
+// there is no packed 64 bits multiplication or division before AVX-512, only + and - are vectorized
+template <simd::Operation op>
+void applySSE2(const int64_t *left, const int64_t *right, int64_t *out, size_t size) {
+	size_t i = 0;
+	for (; i + 2 <= size; i += 2) {
+		__m128i const a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left + i));
+		__m128i const b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right + i));
+		if constexpr (op == simd::ADD) {
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_add_epi64(a, b));
+		} else {
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_sub_epi64(a, b));
+		}
+	}
+	applyScalar<op>(left + i, right + i, out + i, size - i);
+}
+
+template <simd::Operation op>
+__attribute__((target("avx2"))) void applyAVX2(const int64_t *left, const int64_t *right,
+												int64_t *out, size_t size) {
+	size_t i = 0;
+	for (; i + 4 <= size; i += 4) {
+		__m256i const a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(left + i));
+		__m256i const b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(right + i));
+		if constexpr (op == simd::ADD) {
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), _mm256_add_epi64(a, b));
+		} else {
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), _mm256_sub_epi64(a, b));
+		}
+	}
+	applyScalar<op>(left + i, right + i, out + i, size - i);
+}
+
+float horizontalSum(__m128 values) {
+	float lanes[4];
+	_mm_storeu_ps(lanes, values);
+	return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+float sumSSE2(const float *values, size_t size) {
+	__m128 accumulator = _mm_setzero_ps();
+	size_t i = 0;
+	for (; i + 4 <= size; i += 4) {
+		accumulator = _mm_add_ps(accumulator, _mm_loadu_ps(values + i));
+	}
+	return horizontalSum(accumulator) + sumScalar(values + i, size - i);
+}
+
+__attribute__((target("avx2"))) float sumAVX2(const float *values, size_t size) {
+	__m256 accumulator = _mm256_setzero_ps();
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8) {
+		accumulator = _mm256_add_ps(accumulator, _mm256_loadu_ps(values + i));
+	}
+	__m128 const half =
+		_mm_add_ps(_mm256_castps256_ps128(accumulator), _mm256_extractf128_ps(accumulator, 1));
+	return horizontalSum(half) + sumScalar(values + i, size - i);
+}
+
+int64_t sumSSE2(const int64_t *values, size_t size) {
+	__m128i accumulator = _mm_setzero_si128();
+	size_t i = 0;
+	for (; i + 2 <= size; i += 2) {
+		accumulator = _mm_add_epi64(
+			accumulator, _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i)));
+	}
+	int64_t lanes[2];
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), accumulator);
+	return lanes[0] + lanes[1] + sumScalar(values + i, size - i);
+}
+
+__attribute__((target("avx2"))) int64_t sumAVX2(const int64_t *values, size_t size) {
+	__m256i accumulator = _mm256_setzero_si256();
+	size_t i = 0;
+	for (; i + 4 <= size; i += 4) {
+		accumulator = _mm256_add_epi64(
+			accumulator, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i)));
+	}
+	int64_t lanes[4];
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), accumulator);
+	return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumScalar(values + i, size - i);
+}
+
+template <bool isMin> float minMaxSSE2(const float *values, size_t size) {
+	size_t i = 0;
+	float result = values[0];
+	if (size >= 4) {
+		__m128 accumulator = _mm_loadu_ps(values);
+		for (i = 4; i + 4 <= size; i += 4) {
+			__m128 const v = _mm_loadu_ps(values + i);
+			accumulator = isMin ? _mm_min_ps(accumulator, v) : _mm_max_ps(accumulator, v);
+		}
+		float lanes[4];
+		_mm_storeu_ps(lanes, accumulator);
+		result = isMin ? minScalar(lanes, 4, lanes[0]) : maxScalar(lanes, 4, lanes[0]);
+	}
+	return isMin ? minScalar(values + i, size - i, result)
+				 : maxScalar(values + i, size - i, result);
+}
+
+template <bool isMin>
+__attribute__((target("avx2"))) float minMaxAVX2(const float *values, size_t size) {
+	size_t i = 0;
+	float result = values[0];
+	if (size >= 8) {
+		__m256 accumulator = _mm256_loadu_ps(values);
+		for (i = 8; i + 8 <= size; i += 8) {
+			__m256 const v = _mm256_loadu_ps(values + i);
+			accumulator = isMin ? _mm256_min_ps(accumulator, v) : _mm256_max_ps(accumulator, v);
+		}
+		float lanes[8];
+		_mm256_storeu_ps(lanes, accumulator);
+		result = isMin ? minScalar(lanes, 8, lanes[0]) : maxScalar(lanes, 8, lanes[0]);
+	}
+	return isMin ? minScalar(values + i, size - i, result)
+				 : maxScalar(values + i, size - i, result);
+}
+
+template <bool isMin>
+__attribute__((target("avx2"))) int64_t minMaxAVX2(const int64_t *values, size_t size) {
+	size_t i = 0;
+	int64_t result = values[0];
+	if (size >= 4) {
+		__m256i accumulator = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values));
+		for (i = 4; i + 4 <= size; i += 4) {
+			__m256i const v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+			__m256i const greater = _mm256_cmpgt_epi64(accumulator, v);
+			accumulator = isMin ? _mm256_blendv_epi8(accumulator, v, greater)
+								: _mm256_blendv_epi8(v, accumulator, greater);
+		}
+		int64_t lanes[4];
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), accumulator);
+		result = isMin ? minScalar(lanes, 4, lanes[0]) : maxScalar(lanes, 4, lanes[0]);
+	}
+	return isMin ? minScalar(values + i, size - i, result)
+				 : maxScalar(values + i, size - i, result);
+}
+
+float dotSSE2(const float *left, const float *right, size_t size) {
+	__m128 accumulator = _mm_setzero_ps();
+	size_t i = 0;
+	for (; i + 4 <= size; i += 4) {
+		accumulator =
+			_mm_add_ps(accumulator, _mm_mul_ps(_mm_loadu_ps(left + i), _mm_loadu_ps(right + i)));
+	}
+	return horizontalSum(accumulator) + dotScalar(left + i, right + i, size - i);
+}
+
+__attribute__((target("avx2"))) float dotAVX2(const float *left, const float *right,
+											   size_t size) {
+	__m256 accumulator = _mm256_setzero_ps();
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8) {
+		accumulator = _mm256_add_ps(
+			accumulator, _mm256_mul_ps(_mm256_loadu_ps(left + i), _mm256_loadu_ps(right + i)));
+	}
+	__m128 const half =
+		_mm_add_ps(_mm256_castps256_ps128(accumulator), _mm256_extractf128_ps(accumulator, 1));
+	return horizontalSum(half) + dotScalar(left + i, right + i, size - i);
+}
+#endif
+
+template <simd::Operation op, typename T>
+void dispatchApply(const T *left, const T *right, T *out, size_t size) {
+#if defined(__x86_64__)
+	constexpr bool vectorized = std::is_same_v<T, float> || op == simd::ADD || op == simd::SUB;
+	if constexpr (vectorized) {
+		switch (simd::instructionSet()) {
+			case simd::AVX2:
+				return applyAVX2<op>(left, right, out, size);
+			case simd::SSE2:
+				return applySSE2<op>(left, right, out, size);
+			default:
+				break;
+		}
+	}
+#endif
+	applyScalar<op>(left, right, out, size);
+}
+
+template <typename T>
+void dispatchApply(simd::Operation op, const T *left, const T *right, T *out, size_t size) {
+	switch (op) {
+		case simd::ADD:
+			return dispatchApply<simd::ADD>(left, right, out, size);
+		case simd::SUB:
+			return dispatchApply<simd::SUB>(left, right, out, size);
+		case simd::MUL:
+			return dispatchApply<simd::MUL>(left, right, out, size);
+		case simd::DIV:
+			return dispatchApply<simd::DIV>(left, right, out, size);
+	}
+}
+} // namespace
+
+simd::InstructionSet simd::instructionSet() {
+	static const InstructionSet instructionSet = detectInstructionSet();
+	return instructionSet;
+}
+
+const char *simd::instructionSetName() {
+	switch (simd::instructionSet()) {
+		case AVX2:
+			return "avx2";
+		case SSE2:
+			return "sse2";
+		default:
+			return "scalar";
+	}
+}
+
+void simd::apply(Operation op, const float *left, const float *right, float *out, size_t size) {
+	dispatchApply(op, left, right, out, size);
+}
+
+void simd::apply(Operation op, const int64_t *left, const int64_t *right, int64_t *out,
+				 size_t size) {
+	dispatchApply(op, left, right, out, size);
+}
+
+float simd::sum(const float *values, size_t size) {
+#if defined(__x86_64__)
+	switch (simd::instructionSet()) {
+		case AVX2:
+			return sumAVX2(values, size);
+		case SSE2:
+			return sumSSE2(values, size);
+		default:
+			break;
+	}
+#endif
+	return sumScalar(values, size);
+}
+
+int64_t simd::sum(const int64_t *values, size_t size) {
+#if defined(__x86_64__)
+	switch (simd::instructionSet()) {
+		case AVX2:
+			return sumAVX2(values, size);
+		case SSE2:
+			return sumSSE2(values, size);
+		default:
+			break;
+	}
+#endif
+	return sumScalar(values, size);
+}
+
+float simd::min(const float *values, size_t size) {
+#if defined(__x86_64__)
+	switch (simd::instructionSet()) {
+		case AVX2:
+			return minMaxAVX2<true>(values, size);
+		case SSE2:
+			return minMaxSSE2<true>(values, size);
+		default:
+			break;
+	}
+#endif
+	return minScalar(values, size, values[0]);
+}
+
+int64_t simd::min(const int64_t *values, size_t size) {
+#if defined(__x86_64__)
+	// 64 bits comparisons need SSE4.2, so SSE2 machines use the scalar loop
+	if (simd::instructionSet() == AVX2) {
+		return minMaxAVX2<true>(values, size);
+	}
+#endif
+	return minScalar(values, size, values[0]);
+}
+
+float simd::max(const float *values, size_t size) {
+#if defined(__x86_64__)
+	switch (simd::instructionSet()) {
+		case AVX2:
+			return minMaxAVX2<false>(values, size);
+		case SSE2:
+			return minMaxSSE2<false>(values, size);
+		default:
+			break;
+	}
+#endif
+	return maxScalar(values, size, values[0]);
+}
+
+int64_t simd::max(const int64_t *values, size_t size) {
+#if defined(__x86_64__)
+	if (simd::instructionSet() == AVX2) {
+		return minMaxAVX2<false>(values, size);
+	}
+#endif
+	return maxScalar(values, size, values[0]);
+}
+
+float simd::dot(const float *left, const float *right, size_t size) {
+#if defined(__x86_64__)
+	switch (simd::instructionSet()) {
+		case AVX2:
+			return dotAVX2(left, right, size);
+		case SSE2:
+			return dotSSE2(left, right, size);
+		default:
+			break;
+	}
+#endif
+	return dotScalar(left, right, size);
+}
+
+int64_t simd::dot(const int64_t *left, const int64_t *right, size_t size) {
+	return dotScalar(left, right, size);
+}
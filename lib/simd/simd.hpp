@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Vectorized kernels used by the element-wise list operators and the reduction builtins.
+ * The instruction set (AVX2, SSE2 or plain scalar code) is selected once at runtime via CPUID,
+ * every kernel has a scalar fallback so the results are the same on every machine.
+ */
+namespace simd {
+enum Operation { ADD, SUB, MUL, DIV };
+
+enum InstructionSet { SCALAR, SSE2, AVX2 };
+
+InstructionSet instructionSet();
+const char *instructionSetName();
+
+void apply(Operation op, const float *left, const float *right, float *out, size_t size);
+void apply(Operation op, const int64_t *left, const int64_t *right, int64_t *out, size_t size);
+
+float sum(const float *values, size_t size);
+int64_t sum(const int64_t *values, size_t size);
+float min(const float *values, size_t size);
+int64_t min(const int64_t *values, size_t size);
+float max(const float *values, size_t size);
+int64_t max(const int64_t *values, size_t size);
+float dot(const float *left, const float *right, size_t size);
+int64_t dot(const int64_t *left, const int64_t *right, size_t size);
+}; // namespace simd
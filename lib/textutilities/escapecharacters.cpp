@@ -14,7 +14,7 @@ std::array<std::pair<std::regex, std::string>, 5> escapes = {
  * @return std::string the string with the escape sequences replaced
  */
 std::string escapeCharacters(std::string_view str) {
-	std::string result = str.data();
+	std::string result(str);
 	for (size_t i = 0; i < escapes.size(); i++) {
 		std::regex regex = escapes[i].first;
 		std::string replacement = escapes[i].second;
@@ -24,5 +24,5 @@ std::string escapeCharacters(std::string_view str) {
 }
 
 std::string removeEscapeCharacters(std::string_view str) {
-	return std::regex_replace(str.data(), std::regex("\n"), "\\n");
+	return std::regex_replace(std::string(str), std::regex("\n"), "\\n");
 }
\ No newline at end of file
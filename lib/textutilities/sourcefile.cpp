@@ -0,0 +1,152 @@
+#include "textutilities/sourcefile.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+std::unordered_map<std::string, std::unique_ptr<SourceFile>> SourceFile::files;
+std::deque<std::string> SourceFile::keptTexts;
+
+SourceFile::SourceFile(const char *data, size_t size) : data(data), size(size) {
+	this->splitLines();
+}
+
+SourceFile::~SourceFile() {
+	if (this->size > 0) {
+		munmap(const_cast<char *>(this->data), this->size);
+	}
+}
+
+/**
+ * @brief map a source file in memory, a file which is already mapped is not mapped again
+ *
+ * @param path the path of the file
+ * @param error the error message if the file can't be opened
+ * @return SourceFile* the mapped file or nullptr if an error occurred
+ */
+SourceFile *SourceFile::open(std::string_view path, std::string &error) {
+	if (SourceFile *file = SourceFile::find(path); file != nullptr) {
+		return file;
+	}
+
+	const std::string pathString(path);
+	const int fd = ::open(pathString.c_str(), O_RDONLY);
+	struct stat fileStat {};
+	if (fd < 0 || fstat(fd, &fileStat) != 0) {
+		error = "Failled to open file " + pathString + " : " + std::strerror(errno);
+		if (fd >= 0) {
+			close(fd);
+		}
+		return nullptr;
+	}
+
+	const auto size = static_cast<size_t>(fileStat.st_size);
+	const char *data = "";
+	if (size > 0) {
+		void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping == MAP_FAILED) {
+			error = "Failled to map file " + pathString + " : " + std::strerror(errno);
+			close(fd);
+			return nullptr;
+		}
+		madvise(mapping, size, MADV_SEQUENTIAL);
+		data = static_cast<const char *>(mapping);
+	}
+	close(fd);
+
+	std::unique_ptr<SourceFile> &file = SourceFile::files[pathString];
+	file.reset(new SourceFile(data, size));
+	return file.get();
+}
+
+/**
+ * @brief get a file which was already mapped
+ *
+ * @param path the path of the file
+ * @return SourceFile* the file or nullptr if it isn't mapped
+ */
+SourceFile *SourceFile::find(std::string_view path) {
+	auto it = SourceFile::files.find(std::string(path));
+	if (it == SourceFile::files.end()) {
+		return nullptr;
+	}
+	return it->second.get();
+}
+
+/**
+ * @brief keep a text which doesn't come from a file (the piped input) until the end of the
+ * program, so it can be referenced by tokens like a mapped file
+ *
+ * @param text the text to keep
+ * @return std::string_view a view on the kept text
+ */
+std::string_view SourceFile::keep(std::string text) {
+	return SourceFile::keptTexts.emplace_back(std::move(text));
+}
+
+/**
+ * @brief unmap every file when the program exits, the tokens made from them and the values they
+ * hold are released with their arena
+ */
+void SourceFile::closeAll() {
+	SourceFile::files.clear();
+}
+
+std::string_view SourceFile::getContent() const {
+	return {this->data, this->size};
+}
+
+/**
+ * @brief get the lines of the file without their line feed, like std::getline does
+ *
+ * @return const std::vector<std::string_view>& the lines of the file
+ */
+const std::vector<std::string_view> &SourceFile::getLines() const {
+	return this->lines;
+}
+
+/**
+ * @brief get a line of the file
+ *
+ * @param line the line number, starting at 1
+ * @return std::string_view the line or an empty view if the line doesn't exist
+ */
+std::string_view SourceFile::getLine(size_t line) const {
+	if (line == 0 || line > this->lines.size()) {
+		return {};
+	}
+	return this->lines[line - 1];
+}
+
+/**
+ * @brief get a hash of the content of the file, it identifies a version of the file in the
+ * program cache
+ *
+ * @return uint64_t the hash of the content
+ */
+uint64_t SourceFile::getHash() {
+	if (!this->hash.has_value()) {
+		this->hash = std::hash<std::string_view>()(this->getContent());
+	}
+	return this->hash.value();
+}
+
+Arena &SourceFile::getArena() {
+	return this->arena;
+}
+
+void SourceFile::splitLines() {
+	std::string_view content = this->getContent();
+	while (!content.empty()) {
+		const size_t end = content.find('\n');
+		if (end == std::string_view::npos) {
+			this->lines.push_back(content);
+			break;
+		}
+		this->lines.push_back(content.substr(0, end));
+		content.remove_prefix(end + 1);
+	}
+}
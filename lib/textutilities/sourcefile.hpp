@@ -0,0 +1,48 @@
+#pragma once
+
+#include "arena/arena.hpp"
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief a source file mapped in memory, the tokens reference their text directly in the mapping
+ * so it is kept until the end of the program. The tokens and the blocks made from the file are
+ * allocated in its arena
+ */
+class SourceFile {
+  public:
+	SourceFile(const SourceFile &other) = delete;
+	SourceFile &operator=(const SourceFile &other) = delete;
+	~SourceFile();
+
+	static SourceFile *open(std::string_view path, std::string &error);
+	static SourceFile *find(std::string_view path);
+	static std::string_view keep(std::string text);
+	static void closeAll();
+
+	std::string_view getContent() const;
+	const std::vector<std::string_view> &getLines() const;
+	std::string_view getLine(size_t line) const;
+	uint64_t getHash();
+	Arena &getArena();
+
+  private:
+	SourceFile(const char *data, size_t size);
+	void splitLines();
+
+	const char *data;
+	size_t size;
+	std::vector<std::string_view> lines;
+	// hash of the content, computed the first time it is needed
+	std::optional<uint64_t> hash;
+	Arena arena;
+
+	static std::unordered_map<std::string, std::unique_ptr<SourceFile>> files;
+	static std::deque<std::string> keptTexts;
+};
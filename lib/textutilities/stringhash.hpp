@@ -5,6 +5,9 @@
 
 class StringHash {
   public:
+	// allow lookups with a string_view without building a string
+	using is_transparent = void;
+
 	std::size_t operator()(const std::string &str) const {
 		return std::hash<std::string_view>()(str);
 	}
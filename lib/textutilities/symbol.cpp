@@ -0,0 +1,78 @@
+#include "textutilities/symbol.hpp"
+
+#include <mutex>
+#include <stdexcept>
+
+Symbol::Table::Table() {
+	this->chunks[0] = new std::string[CHUNK_SIZE];
+	this->ids.emplace(this->chunks[0][0], 0);
+	this->size.store(1, std::memory_order_release);
+}
+
+Symbol::Table::~Table() {
+	for (std::string *chunk : this->chunks) {
+		delete[] chunk;
+	}
+}
+
+uint32_t Symbol::intern(std::string_view name) {
+	Table &table = Symbol::table();
+	{
+		std::shared_lock const lock(table.mutex);
+		if (auto it = table.ids.find(name); it != table.ids.end()) {
+			return it->second;
+		}
+	}
+	std::unique_lock const lock(table.mutex);
+	if (auto it = table.ids.find(name); it != table.ids.end()) {
+		return it->second;
+	}
+	auto const id = table.size.load(std::memory_order_relaxed);
+	if (id == CHUNK_SIZE * MAX_CHUNKS) {
+		throw std::runtime_error("Too many symbols");
+	}
+	std::string *&chunk = table.chunks[id / CHUNK_SIZE];
+	if (chunk == nullptr) {
+		chunk = new std::string[CHUNK_SIZE];
+	}
+	chunk[id % CHUNK_SIZE] = name;
+	table.ids.emplace(chunk[id % CHUNK_SIZE], id);
+	// publish the name, a thread which acquires the size sees the chunk and the string
+	table.size.store(id + 1, std::memory_order_release);
+	return id;
+}
+
+Symbol::Symbol(std::string_view name) : value(intern(name)) {}
+
+Symbol::Symbol(const std::string &name) : value(intern(name)) {}
+
+Symbol::Symbol(const char *name) : value(intern(name)) {}
+
+Symbol::Symbol(uint32_t id) : value(id) {}
+
+uint32_t Symbol::id() const {
+	return this->value;
+}
+
+const std::string &Symbol::name() const {
+	Table const &table = Symbol::table();
+	// synchronizes with the store which published this symbol, no lock is needed because
+	// the chunks and the published strings are never modified again
+	table.size.load(std::memory_order_acquire);
+	return table.chunks[this->value / CHUNK_SIZE][this->value % CHUNK_SIZE];
+}
+
+/**
+ * @brief get the symbol of a name without interning it
+ *
+ * @param name the name to search
+ * @return std::optional<Symbol> the symbol if the name was already interned
+ */
+std::optional<Symbol> Symbol::find(std::string_view name) {
+	Table &table = Symbol::table();
+	std::shared_lock const lock(table.mutex);
+	if (auto it = table.ids.find(name); it != table.ids.end()) {
+		return Symbol(it->second);
+	}
+	return std::nullopt;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief an interned identifier, each distinct name gets a stable integer id the first time it is
+ * seen. Symbol tables are keyed by symbols so a lookup never builds or hashes a string once the
+ * lexer interned the names
+ */
+class Symbol {
+  public:
+	Symbol() = default;
+	Symbol(std::string_view name);
+	Symbol(const std::string &name);
+	Symbol(const char *name);
+
+	uint32_t id() const;
+	const std::string &name() const;
+
+	bool operator==(const Symbol &other) const = default;
+
+	static std::optional<Symbol> find(std::string_view name);
+
+  private:
+	explicit Symbol(uint32_t id);
+
+	static uint32_t intern(std::string_view name);
+
+	static constexpr size_t CHUNK_SIZE = 4096;
+	static constexpr size_t MAX_CHUNKS = 4096;
+
+	/**
+	 * @brief the names are stored in chunks which are never moved or freed, a name is published
+	 * by the size so name() can read it without taking the lock, only intern and find do
+	 */
+	struct Table {
+		Table();
+		~Table();
+
+		std::shared_mutex mutex;
+		std::array<std::string *, MAX_CHUNKS> chunks{};
+		std::atomic<uint32_t> size = 0;
+		std::unordered_map<std::string_view, uint32_t> ids;
+	};
+	/**
+	 * @brief the table is defined inline so the interpreter and the native modules, which both
+	 * link the library statically, are given the same table by the dynamic linker
+	 */
+	static Table &table() {
+		static Table table;
+		return table;
+	}
+
+	uint32_t value = 0;
+};
+
+/**
+ * @brief symbol ids are dense so they are their own hash
+ */
+class SymbolHash {
+  public:
+	std::size_t operator()(const Symbol &symbol) const {
+		return symbol.id();
+	}
+};
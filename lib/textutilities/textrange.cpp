@@ -28,6 +28,14 @@ std::string TextRange::getLine(std::string_view code) const {
  * @return TextRange the merged range
  */
 TextRange TextRange::merge(const TextRange &other) {
+	// the shared constant values have no range
+	if (other.isEmpty()) {
+		return *this;
+	}
+	if (this->isEmpty()) {
+		*this = other;
+		return *this;
+	}
 	if (other.line > this->line)
 		line = other.line;
 	if (other.columnStart < this->columnStart)
@@ -9,7 +9,7 @@
  */
 std::vector<std::string> split(std::string_view str, char delimiter) {
 	std::vector<std::string> result;
-	std::stringstream ss(str.data());
+	std::stringstream ss{std::string(str)};
 	std::string item;
 	while (std::getline(ss, item, delimiter)) {
 		result.push_back(item);
@@ -72,10 +72,10 @@ std::string extractFilePath(std::string_view path) {
 
 bool openFile(std::ifstream &file, std::string_view fileName, std::string &error) {
 	try {
-		file.open(fileName.data());
+		file.open(std::string(fileName));
 		if (file.fail()) {
 			error = "Failled to open file ";
-			error += fileName.data();
+			error += fileName;
 			error += " : ";
 			error += std::strerror(errno);
 			return false;
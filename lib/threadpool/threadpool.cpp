@@ -0,0 +1,62 @@
+#include "threadpool/threadpool.hpp"
+
+#include <algorithm>
+#include <csignal>
+
+ThreadPool::ThreadPool(size_t threads) {
+	this->workers.reserve(threads);
+	for (size_t i = 0; i < threads; i++) {
+		this->workers.emplace_back(&ThreadPool::work, this);
+	}
+}
+
+/**
+ * @brief finish the tasks which are already submitted and stop the threads
+ */
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> const lock(this->mutex);
+		this->stopping = true;
+	}
+	this->condition.notify_all();
+	for (std::thread &worker : this->workers) {
+		worker.join();
+	}
+}
+
+size_t ThreadPool::size() const {
+	return this->workers.size();
+}
+
+/**
+ * @brief the pool used by the interpreter, it has one thread per core besides the main thread
+ * which keeps working while the pool runs, on a single core the tasks run directly. The threads are
+ * only started the first time the pool is used
+ *
+ * @return ThreadPool& the shared pool
+ */
+ThreadPool &ThreadPool::shared() {
+	static ThreadPool pool(std::max(1U, std::thread::hardware_concurrency()) - 1);
+	return pool;
+}
+
+void ThreadPool::work() {
+	// the profiler timer must only interrupt the interpreter thread
+	sigset_t signals;
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGPROF);
+	pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+	while (true) {
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->condition.wait(lock, [this]() { return this->stopping || !this->tasks.empty(); });
+			if (this->tasks.empty()) {
+				return;
+			}
+			task = std::move(this->tasks.front());
+			this->tasks.pop();
+		}
+		task();
+	}
+}
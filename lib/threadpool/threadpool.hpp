@@ -0,0 +1,54 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief fixed set of threads which run submitted tasks in submission order. A pool without
+ * threads runs the tasks directly when they are submitted
+ */
+class ThreadPool {
+  public:
+	explicit ThreadPool(size_t threads);
+	ThreadPool(const ThreadPool &other) = delete;
+	ThreadPool &operator=(const ThreadPool &other) = delete;
+	~ThreadPool();
+
+	template <typename F>
+	std::future<std::invoke_result_t<F>> submit(F &&task) {
+		using Result = std::invoke_result_t<F>;
+		// std::function must be copyable, the task is shared to fit in it
+		auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+		std::future<Result> future = packaged->get_future();
+		if (this->workers.empty()) {
+			(*packaged)();
+			return future;
+		}
+		{
+			std::lock_guard<std::mutex> const lock(this->mutex);
+			this->tasks.emplace([packaged]() { (*packaged)(); });
+		}
+		this->condition.notify_one();
+		return future;
+	}
+
+	size_t size() const;
+
+	static ThreadPool &shared();
+
+  private:
+	void work();
+
+	std::vector<std::thread> workers;
+	std::queue<std::function<void()>> tasks;
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool stopping = false;
+};
@@ -1,36 +1,10 @@
 #pragma once
 
-#include "ctre/ctre.hpp"
 #include "value/valuetypes.hpp"
 #include <string>
 #include <unordered_map>
 #include <vector>
 
-constexpr auto keywordsRegex = ctre::match<"^("
-										   "fun|"
-										   "nuf|"
-										   "if|"
-										   "fi|"
-										   "else|"
-										   "while|"
-										   "elihw|"
-										   "for|"
-										   "rof|"
-										   "return|"
-										   "continue|"
-										   "break|"
-										   "try|"
-										   "catch|"
-										   "finally|"
-										   "yrt|"
-										   "import|"
-										   "importAs|"
-										   "struct|"
-										   "tcurts|"
-										   "get|"
-										   "funsig"
-										   ")$">;
-
 enum KeywordEnum {
 	KEYWORD_FUN,
 	KEYWORD_NUF,
@@ -0,0 +1,230 @@
+#include "tokens/scanner.hpp"
+
+namespace {
+bool isDigit(char c) {
+	return c >= '0' && c <= '9';
+}
+
+bool isBinDigit(char c) {
+	return c == '0' || c == '1';
+}
+
+bool isHexDigit(char c) {
+	return isDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+bool isLower(char c) {
+	return c >= 'a' && c <= 'z';
+}
+
+bool isUpper(char c) {
+	return c >= 'A' && c <= 'Z';
+}
+
+bool isAlphaNumeric(char c) {
+	return isLower(c) || isUpper(c) || isDigit(c);
+}
+
+bool isCapsCharacter(char c) {
+	return isUpper(c) || isDigit(c) || c == '_';
+}
+
+/**
+ * @brief get the index of the first character after start which doesn't match the predicate
+ */
+template <typename Predicate>
+size_t skip(std::string_view str, size_t start, Predicate predicate) {
+	while (start < str.size() && predicate(str[start])) {
+		start++;
+	}
+	return start;
+}
+
+bool isTypeName(std::string_view word) {
+	return word == "int" || word == "float" || word == "bool" || word == "string" ||
+		   word == "function" || word == "none" || word == "list";
+}
+
+ScannedToken makeToken(std::string_view str, TokenType type, size_t size) {
+	return {type, str.substr(0, size), size};
+}
+
+/**
+ * @brief scan a quoted string starting at the given index, the value doesn't contain the quotes
+ */
+std::optional<ScannedToken> scanString(std::string_view str, size_t quote, TokenType type) {
+	const size_t end = str.find('"', quote + 1);
+	if (end == std::string_view::npos) {
+		return std::nullopt;
+	}
+	return ScannedToken{type, str.substr(quote + 1, end - quote - 1), end + 1};
+}
+
+/**
+ * @brief scan booleans, fstrings, types and literals
+ */
+std::optional<ScannedToken> scanWord(std::string_view str) {
+	if (str.starts_with("true")) {
+		return makeToken(str, TokenType::TOKEN_TYPE_BOOL, 4);
+	}
+	if (str.starts_with("false")) {
+		return makeToken(str, TokenType::TOKEN_TYPE_BOOL, 5);
+	}
+	if (str.starts_with("f\"")) {
+		if (auto fstring = scanString(str, 1, TokenType::TOKEN_TYPE_FSTRING)) {
+			return fstring;
+		}
+	}
+	const size_t end = skip(str, 1, isAlphaNumeric);
+	if (isTypeName(str.substr(0, end)) && (end == str.size() || str[end] != '_')) {
+		return makeToken(str, TokenType::TOKEN_TYPE_VALUE_TYPE, end);
+	}
+	return makeToken(str, TokenType::TOKEN_TYPE_LITERAL, end);
+}
+
+/**
+ * @brief scan caps literals (CONSTANT_NAME) and struct names (StructName)
+ */
+std::optional<ScannedToken> scanCapitalizedWord(std::string_view str) {
+	const size_t capsEnd = skip(str, 1, isCapsCharacter);
+	if (capsEnd == str.size() || !isLower(str[capsEnd])) {
+		return makeToken(str, TokenType::TOKEN_TYPE_LITERAL, capsEnd);
+	}
+	const size_t end = skip(str, 1, isAlphaNumeric);
+	if (end == str.size() || str[end] != '_') {
+		return makeToken(str, TokenType::TOKEN_TYPE_STRUCT_NAME, end);
+	}
+	return std::nullopt;
+}
+} // namespace
+
+/**
+ * @brief scan an integer with an optional minus sign
+ */
+std::optional<ScannedToken> scanInt(std::string_view str) {
+	const size_t digitsStart = str.starts_with('-') ? 1 : 0;
+	const size_t end = skip(str, digitsStart, isDigit);
+	if (end == digitsStart) {
+		return std::nullopt;
+	}
+	return makeToken(str, TokenType::TOKEN_TYPE_INT, end);
+}
+
+/**
+ * @brief scan a float with an optional minus sign, the digits on both sides of the dot are
+ * optional but the dot can't be alone
+ */
+std::optional<ScannedToken> scanFloat(std::string_view str) {
+	const size_t dot = skip(str, str.starts_with('-') ? 1 : 0, isDigit);
+	if (dot == str.size() || str[dot] != '.') {
+		return std::nullopt;
+	}
+	const size_t end = skip(str, dot + 1, isDigit);
+	if (end == 1) {
+		return std::nullopt;
+	}
+	return makeToken(str, TokenType::TOKEN_TYPE_FLOAT, end);
+}
+
+std::optional<ScannedToken> scanNumber(std::string_view str) {
+	if (auto number = scanFloat(str)) {
+		return number;
+	}
+	return scanInt(str);
+}
+
+/**
+ * @brief recognize the token at the start of the string in a single pass, the first character
+ * selects the only token classes which can match
+ *
+ * @param str the text to scan, it must not be empty
+ * @return std::optional<ScannedToken> the token or nothing if no token starts here
+ */
+std::optional<ScannedToken> scanToken(std::string_view str) {
+	const char next = str.size() > 1 ? str[1] : '\0';
+	switch (str[0]) {
+		case '0':
+			if (next == 'b' && str.size() > 2 && isBinDigit(str[2])) {
+				return makeToken(str, TokenType::TOKEN_TYPE_BIN, skip(str, 2, isBinDigit));
+			}
+			if (next == 'x' && str.size() > 2 && isHexDigit(str[2])) {
+				return makeToken(str, TokenType::TOKEN_TYPE_HEX, skip(str, 2, isHexDigit));
+			}
+			return scanNumber(str);
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			return scanNumber(str);
+		case '-':
+			if (auto number = scanNumber(str)) {
+				return number;
+			}
+			if (next == '>') {
+				return makeToken(str, TokenType::TOKEN_TYPE_ARROW, 2);
+			}
+			return makeToken(str, TokenType::TOKEN_TYPE_OPERATOR, 1);
+		case '.':
+			if (next == '+' || next == '-' || next == '*' || next == '/') {
+				return makeToken(str, TokenType::TOKEN_TYPE_OPERATOR, 2);
+			}
+			if (auto number = scanNumber(str)) {
+				return number;
+			}
+			return makeToken(str, TokenType::TOKEN_TYPE_DOT, 1);
+		case '[':
+			return makeToken(str, TokenType::TOKEN_TYPE_LEFT_BRACKET, 1);
+		case ']':
+			return makeToken(str, TokenType::TOKEN_TYPE_RIGHT_BRACKET, 1);
+		case '"':
+			return scanString(str, 0, TokenType::TOKEN_TYPE_STRING);
+		case '\t':
+			return makeToken(str, TokenType::TOKEN_TYPE_INDENT, 1);
+		case ':':
+			return makeToken(str, TokenType::TOKEN_TYPE_COLON, 1);
+		case '<':
+		case '>':
+			return makeToken(str, TokenType::TOKEN_TYPE_BOOLEAN_OPERATOR, next == '=' ? 2 : 1);
+		case '=':
+			if (next == '=') {
+				return makeToken(str, TokenType::TOKEN_TYPE_BOOLEAN_OPERATOR, 2);
+			}
+			return makeToken(str, TokenType::TOKEN_TYPE_ASSIGNMENT, 1);
+		case '!':
+			if (next == '=') {
+				return makeToken(str, TokenType::TOKEN_TYPE_BOOLEAN_OPERATOR, 2);
+			}
+			return std::nullopt;
+		case '+':
+		case '*':
+		case '/':
+		case '^':
+		case '%':
+			return makeToken(str, TokenType::TOKEN_TYPE_OPERATOR, 1);
+		case ';':
+			return makeToken(str, TokenType::TOKEN_TYPE_EXPRESSION_SEPARATOR, 1);
+		case '\n':
+			return makeToken(str, TokenType::TOKEN_TYPE_END_OF_LINE, 1);
+		case '#':
+			return makeToken(str, TokenType::TOKEN_TYPE_COMMENT, 1);
+		case '$':
+			if (isLower(next)) {
+				return makeToken(str, TokenType::TOKEN_TYPE_FUN_SIGNATURE,
+								 skip(str, 2, isAlphaNumeric));
+			}
+			return std::nullopt;
+		default:
+			if (isLower(str[0])) {
+				return scanWord(str);
+			}
+			if (isUpper(str[0])) {
+				return scanCapitalizedWord(str);
+			}
+			return std::nullopt;
+	}
+}
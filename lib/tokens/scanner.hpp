@@ -0,0 +1,23 @@
+#pragma once
+
+#include "tokens/tokentypes.hpp"
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+/**
+ * @brief a token recognized by the scanner
+ *
+ * value is the text kept in the token, size is the number of characters consumed
+ * (they are different for strings because the quotes are not part of the value)
+ */
+struct ScannedToken {
+	TokenType type;
+	std::string_view value;
+	size_t size;
+};
+
+std::optional<ScannedToken> scanToken(std::string_view str);
+std::optional<ScannedToken> scanInt(std::string_view str);
+std::optional<ScannedToken> scanFloat(std::string_view str);
+std::optional<ScannedToken> scanNumber(std::string_view str);
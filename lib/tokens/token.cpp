@@ -20,6 +20,16 @@ void Token::setRange(TextRange range) {
 	this->range = range;
 }
 
+/**
+ * @brief get the interned name of the token, the tokens naming a variable carry the symbol
+ * interned by the lexer so only the other tokens build a string
+ *
+ * @return Symbol the symbol of the token text
+ */
+Symbol Token::getSymbol() const {
+	return Symbol(this->getStringValue());
+}
+
 /**
  * @brief convert a TokenType to its string representation
  *
@@ -1,8 +1,8 @@
 #pragma once
 
 #include "textutilities/escapecharacters.hpp"
+#include "textutilities/symbol.hpp"
 #include "textutilities/textrange.hpp"
-#include "tokens/regex.hpp"
 #include "tokens/tokentypes.hpp"
 #include <queue>
 #include <span>
@@ -22,6 +22,7 @@ class Token {
 	std::string getStringType() const;
 
 	virtual std::string getStringValue() const = 0;
+	virtual Symbol getSymbol() const;
 
 	TextRange getRange() const;
 	void setRange(TextRange range);
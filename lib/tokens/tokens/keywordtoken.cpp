@@ -1,52 +1,75 @@
 #include "tokens/tokens/keywordtoken.hpp"
 
-KeywordToken::KeywordToken(TextRange range, std::string_view keyword) : Token(range, TokenType::TOKEN_TYPE_KEYWORD) {
-	if (keyword == "if") {
-		this->keyword = KEYWORD_IF;
-	} else if (keyword == "fi") {
-		this->keyword = KEYWORD_FI;
-	} else if (keyword == "else") {
-		this->keyword = KEYWORD_ELSE;
-	} else if (keyword == "while") {
-		this->keyword = KEYWORD_WHILE;
-	} else if (keyword == "elihw") {
-		this->keyword = KEYWORD_ELIHW;
-	} else if (keyword == "for") {
-		this->keyword = KEYWORD_FOR;
-	} else if (keyword == "rof") {
-		this->keyword = KEYWORD_ROF;
-	} else if (keyword == "return") {
-		this->keyword = KEYWORD_RETURN;
-	} else if (keyword == "continue") {
-		this->keyword = KEYWORD_CONTINUE;
-	} else if (keyword == "break") {
-		this->keyword = KEYWORD_BREAK;
-	} else if (keyword == "try") {
-		this->keyword = KEYWORD_TRY;
-	} else if (keyword == "catch") {
-		this->keyword = KEYWORD_CATCH;
-	} else if (keyword == "finally") {
-		this->keyword = KEYWORD_FINALLY;
-	} else if (keyword == "yrt") {
-		this->keyword = KEYWORD_YRT;
-	} else if (keyword == "fun") {
-		this->keyword = KEYWORD_FUN;
-	} else if (keyword == "nuf") {
-		this->keyword = KEYWORD_NUF;
-	} else if (keyword == "struct") {
-		this->keyword = KEYWORD_STRUCT;
-	} else if (keyword == "tcurts") {
-		this->keyword = KEYWORD_TCURTS;
-	} else if (keyword == "import") {
-		this->keyword = KEYWORD_IMPORT;
-	} else if (keyword == "importAs") {
-		this->keyword = KEYWORD_IMPORTAS;
-	} else if (keyword == "get") {
-		this->keyword = KEYWORD_GET;
-	} else if (keyword == "funsig") {
-		this->keyword = KEYWORD_FUNSIG;
-	} else {
-		throw std::runtime_error("Invalid keyword");
+KeywordToken::KeywordToken(TextRange range, KeywordEnum keyword)
+	: Token(range, TokenType::TOKEN_TYPE_KEYWORD), keyword(keyword) {}
+
+/**
+ * @brief get the keyword matching a literal, the first character selects the few keywords which
+ * have to be compared
+ *
+ * @param literal the literal to check
+ * @return std::optional<KeywordEnum> the keyword or nothing if the literal is not a keyword
+ */
+std::optional<KeywordEnum> KeywordToken::findKeyword(std::string_view literal) {
+	auto compare = [literal](std::string_view name,
+							 KeywordEnum keyword) -> std::optional<KeywordEnum> {
+		if (literal == name) {
+			return keyword;
+		}
+		return std::nullopt;
+	};
+	if (literal.empty()) {
+		return std::nullopt;
+	}
+	std::optional<KeywordEnum> keyword;
+	switch (literal.front()) {
+		case 'b':
+			return compare("break", KEYWORD_BREAK);
+		case 'c':
+			if ((keyword = compare("catch", KEYWORD_CATCH))) {
+				return keyword;
+			}
+			return compare("continue", KEYWORD_CONTINUE);
+		case 'e':
+			if ((keyword = compare("else", KEYWORD_ELSE))) {
+				return keyword;
+			}
+			return compare("elihw", KEYWORD_ELIHW);
+		case 'f':
+			if ((keyword = compare("fun", KEYWORD_FUN)) || (keyword = compare("fi", KEYWORD_FI)) ||
+				(keyword = compare("for", KEYWORD_FOR)) ||
+				(keyword = compare("finally", KEYWORD_FINALLY))) {
+				return keyword;
+			}
+			return compare("funsig", KEYWORD_FUNSIG);
+		case 'g':
+			return compare("get", KEYWORD_GET);
+		case 'i':
+			if ((keyword = compare("if", KEYWORD_IF)) ||
+				(keyword = compare("import", KEYWORD_IMPORT))) {
+				return keyword;
+			}
+			return compare("importAs", KEYWORD_IMPORTAS);
+		case 'n':
+			return compare("nuf", KEYWORD_NUF);
+		case 'r':
+			if ((keyword = compare("return", KEYWORD_RETURN))) {
+				return keyword;
+			}
+			return compare("rof", KEYWORD_ROF);
+		case 's':
+			return compare("struct", KEYWORD_STRUCT);
+		case 't':
+			if ((keyword = compare("try", KEYWORD_TRY))) {
+				return keyword;
+			}
+			return compare("tcurts", KEYWORD_TCURTS);
+		case 'w':
+			return compare("while", KEYWORD_WHILE);
+		case 'y':
+			return compare("yrt", KEYWORD_YRT);
+		default:
+			return std::nullopt;
 	}
 }
 
@@ -1,18 +1,24 @@
 #pragma once
 
+#include <optional>
 #include <string_view>
+#include "arena/arena.hpp"
 #include "tokens/keywords.hpp"
 #include "tokens/token.hpp"
 
 class KeywordToken : public Token {
 	public:
-		KeywordToken(TextRange range, std::string_view keyword);
+		KeywordToken(TextRange range, KeywordEnum keyword);
 
 		KeywordEnum getKeyword() const;
 		std::string getStringValue() const override;
 
 		static std::string keywordString(KeywordEnum keyword);
+		static std::optional<KeywordEnum> findKeyword(std::string_view literal);
 	
 	private:
 		KeywordEnum keyword;
-};
\ No newline at end of file
+};
+
+template <>
+struct ArenaTriviallyDestructible<KeywordToken> : std::true_type {};
@@ -26,12 +26,24 @@ OperatorToken::OperatorToken(TextRange range, TokenType type, std::string_view v
 		this->type = OP_LT;
 	else if (value == "<=")
 		this->type = OP_LE;
+	else if (value == ".+")
+		this->type = OP_VADD;
+	else if (value == ".-")
+		this->type = OP_VSUB;
+	else if (value == ".*")
+		this->type = OP_VMUL;
+	else if (value == "./")
+		this->type = OP_VDIV;
 	else
 		throw std::runtime_error("Invalid operator token: " + std::string(value));
 }
 
 std::string OperatorToken::getStringValue() const {
-	switch (this->type) {
+	return std::string(OperatorToken::operatorString(this->type));
+}
+
+std::string_view OperatorToken::operatorString(OperatorTypes type) {
+	switch (type) {
 		case OP_ADD:
 			return "+";
 		case OP_SUB:
@@ -56,10 +68,23 @@ std::string OperatorToken::getStringValue() const {
 			return "<";
 		case OP_LE:
 			return "<=";
+		case OP_VADD:
+			return ".+";
+		case OP_VSUB:
+			return ".-";
+		case OP_VMUL:
+			return ".*";
+		case OP_VDIV:
+			return "./";
 	}
 	throw std::runtime_error("Invalid operator token");
 }
 
 OperatorToken::OperatorTypes OperatorToken::getOperatorType() const {
 	return this->type;
+}
+
+bool OperatorToken::isVectorOperator() const {
+	return this->type == OP_VADD || this->type == OP_VSUB || this->type == OP_VMUL ||
+		   this->type == OP_VDIV;
 }
\ No newline at end of file
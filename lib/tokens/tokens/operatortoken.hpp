@@ -1,5 +1,6 @@
 #pragma once
 
+#include "arena/arena.hpp"
 #include "tokens/token.hpp"
 #include "tokens/tokentypes.hpp"
 
@@ -21,11 +22,21 @@ class OperatorToken : public Token {
 			OP_GT,
 			OP_GE,
 			OP_LT,
-			OP_LE
+			OP_LE,
+			OP_VADD,
+			OP_VSUB,
+			OP_VMUL,
+			OP_VDIV
 		};
 
 		OperatorTypes getOperatorType() const;
+		bool isVectorOperator() const;
+
+		static std::string_view operatorString(OperatorTypes type);
 
 	private:
 		OperatorTypes type;
-};
\ No newline at end of file
+};
+
+template <>
+struct ArenaTriviallyDestructible<OperatorToken> : std::true_type {};
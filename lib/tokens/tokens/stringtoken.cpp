@@ -13,10 +13,10 @@ void StringToken::setValue(std::string_view value) {
 	this->value = value;
 }
 
-std::string StringToken::getValue() const {
+std::string_view StringToken::getValue() const {
 	return this->value;
 }
 
 std::string StringToken::getStringValue() const {
-	return this->value;
+	return std::string(this->value);
 }
\ No newline at end of file
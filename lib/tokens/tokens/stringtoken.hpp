@@ -1,5 +1,6 @@
 #pragma once
 
+#include "arena/arena.hpp"
 #include "tokens/token.hpp"
 #include "tokens/tokentypes.hpp"
 
@@ -10,9 +11,14 @@ class StringToken : public Token {
 		~StringToken() override {};
 
 		void setValue(std::string_view value);
-		std::string getValue() const;
+		std::string_view getValue() const;
 		std::string getStringValue() const;
 
 	private:
-		std::string value;
-};
\ No newline at end of file
+		// the text is owned by the source file, see SourceFile
+		std::string_view value;
+};
+
+// the text is a view, there is nothing to release
+template <>
+struct ArenaTriviallyDestructible<StringToken> : std::true_type {};
@@ -1,4 +1,5 @@
 #include "tokens/tokens/valuetoken.hpp"
+#include "value/types/variable.hpp"
 
 ValueToken::ValueToken(Value *value, TokenType type) : 
 	Token(value->getRange(), type),
@@ -25,3 +26,10 @@ ValueType ValueToken::getValueType() const {
 inline std::string ValueToken::getStringValue() const {
 	return this->value->getStringValue();
 }
+
+Symbol ValueToken::getSymbol() const {
+	if (this->value->getType() == VARIABLE) {
+		return static_cast<const Variable *>(this->value)->getSymbol();
+	}
+	return Token::getSymbol();
+}
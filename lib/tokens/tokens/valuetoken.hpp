@@ -13,6 +13,7 @@ class ValueToken : public Token {
 		ValueType getValueType() const;
 
 		std::string getStringValue() const override;
+		Symbol getSymbol() const override;
 
 	private:
 		Value *value;
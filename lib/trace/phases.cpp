@@ -0,0 +1,95 @@
+#include "trace/phases.hpp"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+// initialized before the other static objects so the static initialization can be measured
+__attribute__((init_priority(101))) const std::chrono::steady_clock::time_point
+	Phases::processStart = std::chrono::steady_clock::now();
+std::atomic<bool> Phases::enabled = false;
+std::mutex Phases::mutex;
+std::vector<Phases::Phase> Phases::phases;
+thread_local Phases::Scope *Phases::current = nullptr;
+
+/**
+ * @brief start a phase and pause the phase running on the thread
+ *
+ * @param phase what is done, the phases with the same name are displayed together
+ * @param unit the file or the module the phase works on, it can be empty
+ */
+Phases::Scope::Scope(const char *phase, std::string_view unit) {
+	if (!Phases::enabled) {
+		return;
+	}
+	this->phase = phase;
+	this->unit = unit;
+	this->resumed = std::chrono::steady_clock::now();
+	this->parent = Phases::current;
+	if (this->parent != nullptr) {
+		this->parent->elapsed += this->resumed - this->parent->resumed;
+	}
+	Phases::current = this;
+}
+
+Phases::Scope::~Scope() {
+	if (this->phase == nullptr) {
+		return;
+	}
+	const auto end = std::chrono::steady_clock::now();
+	Phases::current = this->parent;
+	if (this->parent != nullptr) {
+		this->parent->resumed = end;
+	}
+	Phases::add(this->phase, this->unit, this->elapsed + (end - this->resumed));
+}
+
+/**
+ * @brief measure the phases until the program exits, they are displayed at exit. The time between
+ * the static initialization of the interpreter and this call is the first phase
+ */
+void Phases::start() {
+	Phases::enabled = true;
+	Phases::add("static init", "", std::chrono::steady_clock::now() - Phases::processStart);
+	// the exit builtin doesn't return to main
+	std::atexit(&Phases::stop);
+}
+
+/**
+ * @brief stop measuring and display the phases in the order they first ran, the phases which are
+ * still running are lost
+ */
+void Phases::stop() {
+	if (!Phases::enabled) {
+		return;
+	}
+	const std::chrono::duration<double, std::milli> wall =
+		std::chrono::steady_clock::now() - Phases::processStart;
+	std::lock_guard<std::mutex> const lock(Phases::mutex);
+	Phases::enabled = false;
+	std::cerr << std::fixed << std::setprecision(3);
+	std::cerr << std::left << std::setw(16) << "Phase" << std::setw(32) << "Unit" << std::right
+			  << std::setw(8) << "Calls" << std::setw(14) << "Time (ms)" << std::endl;
+	for (const Phase &phase : Phases::phases) {
+		const std::chrono::duration<double, std::milli> elapsed = phase.elapsed;
+		std::cerr << std::left << std::setw(16) << phase.name << std::setw(32) << phase.unit
+				  << std::right << std::setw(8) << phase.count << std::setw(14) << elapsed.count()
+				  << std::endl;
+	}
+	std::cerr << std::left << std::setw(56) << "wall" << std::right << std::setw(14)
+			  << wall.count() << std::endl;
+	std::cerr << std::defaultfloat;
+}
+
+void Phases::add(const char *phase, std::string_view unit,
+				 std::chrono::steady_clock::duration elapsed) {
+	std::lock_guard<std::mutex> const lock(Phases::mutex);
+	for (Phase &existing : Phases::phases) {
+		if (std::string_view(existing.name) == phase && existing.unit == unit) {
+			existing.count++;
+			existing.elapsed += elapsed;
+			return;
+		}
+	}
+	Phases::phases.push_back({phase, std::string(unit), 1, elapsed});
+}
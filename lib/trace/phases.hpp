@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief measure the wall time of the phases of a run, from the static initialization to the
+ * shutdown, and display it at exit. The phases of a thread are exclusive: a phase started while
+ * another one runs, an import during the analysis for example, pauses it so the times of the
+ * phases add up. The phases run on the thread pool overlap with the ones of the interpreter thread
+ */
+class Phases {
+  public:
+	/**
+	 * @brief a phase from its construction to its destruction, it does nothing if the phases
+	 * aren't measured
+	 */
+	class Scope {
+	  public:
+		Scope(const char *phase, std::string_view unit);
+		Scope(const Scope &other) = delete;
+		Scope &operator=(const Scope &other) = delete;
+		~Scope();
+
+	  private:
+		const char *phase = nullptr;
+		std::string unit;
+		Scope *parent = nullptr;
+		std::chrono::steady_clock::time_point resumed;
+		std::chrono::steady_clock::duration elapsed{};
+	};
+
+	static void start();
+	static void stop();
+
+	static bool isEnabled() {
+		return Phases::enabled;
+	}
+
+  private:
+	struct Phase {
+		const char *name;
+		std::string unit;
+		size_t count;
+		std::chrono::steady_clock::duration elapsed;
+	};
+
+	static void add(const char *phase, std::string_view unit,
+					std::chrono::steady_clock::duration elapsed);
+
+	static const std::chrono::steady_clock::time_point processStart;
+	static std::atomic<bool> enabled;
+	static std::mutex mutex;
+	static std::vector<Phase> phases;
+	static thread_local Scope *current;
+};
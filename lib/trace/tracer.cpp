@@ -0,0 +1,97 @@
+#include "trace/tracer.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <unistd.h>
+
+std::atomic<bool> Tracer::enabled = false;
+std::string Tracer::tracePath;
+std::chrono::steady_clock::time_point Tracer::origin;
+std::mutex Tracer::mutex;
+std::vector<Tracer::Event> Tracer::events;
+
+/**
+ * @brief start a span
+ *
+ * @param category the kind of work, it can be used to filter the events in the viewer
+ * @param name what is done, a function or a file for example
+ */
+Tracer::Span::Span(const char *category, std::string_view name) {
+	if (!Tracer::enabled) {
+		return;
+	}
+	this->category = category;
+	this->name = name;
+	this->start = std::chrono::steady_clock::now();
+}
+
+Tracer::Span::~Span() {
+	if (this->category == nullptr || !Tracer::enabled) {
+		return;
+	}
+	const auto end = std::chrono::steady_clock::now();
+	auto microseconds = [](std::chrono::steady_clock::duration duration) {
+		return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+	};
+	Event event{this->category, std::move(this->name), microseconds(this->start - Tracer::origin),
+				microseconds(end - this->start), gettid()};
+	std::lock_guard<std::mutex> const lock(Tracer::mutex);
+	Tracer::events.push_back(std::move(event));
+}
+
+/**
+ * @brief record the spans until the program exits, they are written in the trace file at exit
+ *
+ * @param tracePath the file to write the trace in
+ */
+void Tracer::start(std::string_view tracePath) {
+	Tracer::tracePath = tracePath;
+	Tracer::origin = std::chrono::steady_clock::now();
+	Tracer::enabled = true;
+	// the exit builtin doesn't return to main
+	std::atexit(&Tracer::stop);
+}
+
+/**
+ * @brief stop recording and write the trace, the spans which are still open are lost
+ */
+void Tracer::stop() {
+	if (!Tracer::enabled) {
+		return;
+	}
+	std::lock_guard<std::mutex> const lock(Tracer::mutex);
+	Tracer::enabled = false;
+	std::ofstream file(Tracer::tracePath);
+	if (!file) {
+		std::cerr << "Can't write the trace in " << Tracer::tracePath << std::endl;
+		return;
+	}
+	const pid_t process = getpid();
+	file << "{\"traceEvents\":[\n";
+	file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << process
+		 << ",\"args\":{\"name\":\"RPNlang\"}}";
+	for (const Event &event : Tracer::events) {
+		file << ",\n{\"name\":";
+		Tracer::writeString(file, event.name);
+		file << ",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"ts\":" << event.start
+			 << ",\"dur\":" << event.duration << ",\"pid\":" << process
+			 << ",\"tid\":" << event.thread << "}";
+	}
+	file << "\n]}\n";
+}
+
+void Tracer::writeString(std::ostream &stream, std::string_view string) {
+	stream << '"';
+	for (const char c : string) {
+		if (c == '"' || c == '\\') {
+			stream << '\\' << c;
+		} else if (static_cast<unsigned char>(c) < 0x20) {
+			constexpr std::string_view digits = "0123456789abcdef";
+			stream << "\\u00" << digits[c >> 4] << digits[c & 0xf];
+		} else {
+			stream << c;
+		}
+	}
+	stream << '"';
+}
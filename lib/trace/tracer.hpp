@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <sys/types.h>
+#include <vector>
+
+/**
+ * @brief record the time spent in the phases of the interpreter as trace events, the events are
+ * written at exit in the JSON format of the Chrome trace viewer and of Perfetto. Spans can be
+ * recorded from any thread, each event keeps the id of its thread
+ */
+class Tracer {
+  public:
+	/**
+	 * @brief a complete event from its construction to its destruction, it does nothing if the
+	 * tracer isn't enabled
+	 */
+	class Span {
+	  public:
+		Span(const char *category, std::string_view name);
+		Span(const Span &other) = delete;
+		Span &operator=(const Span &other) = delete;
+		~Span();
+
+	  private:
+		const char *category = nullptr;
+		std::string name;
+		std::chrono::steady_clock::time_point start;
+	};
+
+	static void start(std::string_view tracePath);
+	static void stop();
+
+	static bool isEnabled() {
+		return Tracer::enabled;
+	}
+
+  private:
+	struct Event {
+		const char *category;
+		std::string name;
+		int64_t start;
+		int64_t duration;
+		pid_t thread;
+	};
+
+	static void writeString(std::ostream &stream, std::string_view string);
+
+	static std::atomic<bool> enabled;
+	static std::string tracePath;
+	static std::chrono::steady_clock::time_point origin;
+	static std::mutex mutex;
+	static std::vector<Event> events;
+};
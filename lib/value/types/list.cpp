@@ -1,12 +1,51 @@
 #include "value/types/list.hpp"
+#include "simd/simd.hpp"
+
+namespace {
+bool isIntegralValue(const Value *value) {
+	return value->getType() == INT || value->getType() == BOOL;
+}
+
+int64_t intValue(const Value *value) {
+	if (value->getType() == BOOL) {
+		return static_cast<const Bool*>(value)->getValue();
+	}
+	return static_cast<const Int*>(value)->getValue();
+}
+
+float floatValue(const Value *value) {
+	if (value->getType() == FLOAT) {
+		return static_cast<const Float*>(value)->getValue();
+	}
+	return intValue(value);
+}
+};
 
 List::List(TextRange range, ValueOwner owner, RPNBaseType listType, const TextRange variableRange) : 
-	Value(ValueType::LIST, range, owner, variableRange), values(), listType(listType) {}
+	Value(ValueType::LIST, range, owner, variableRange), values(), listType(listType) {
+	if (listType.index() == 0) {
+		this->columns = std::make_shared<StructColumns>(std::get<std::string>(listType));
+	}
+}
+
+/**
+ * @brief Construct a list from values owned by the list, for a list of structs the members of the
+ * values are moved to the columns and the structs are deleted
+ */
 List::List(std::vector<Value *> values, TextRange range, ValueOwner owner, RPNBaseType listType, const TextRange variableRange) : 
 	Value(ValueType::LIST, range, owner, variableRange), 
 	values(values),
 	listType(listType)
-{}
+{
+	if (listType.index() == 0) {
+		this->columns = std::make_shared<StructColumns>(std::get<std::string>(listType));
+		for (auto &value : this->values) {
+			this->columns->insert(this->columns->size(), static_cast<const Struct*>(value));
+			Value::deleteValue(&value, Value::OBJECT_VALUE);
+		}
+		this->values.clear();
+	}
+}
 
 List::~List() {
 	for (auto &value : values) {
@@ -22,11 +61,25 @@ std::vector<Value *> List::getValues() const {
 	return values;
 }
 
+bool List::isColumnar() const {
+	return this->columns != nullptr;
+}
+
+std::shared_ptr<StructColumns> List::getColumns() const {
+	return this->columns;
+}
+
 unsigned int List::size() const {
+	if (this->columns != nullptr) {
+		return this->columns->size();
+	}
 	return values.size();
 }
 
 Value *List::at(unsigned int index) const {
+	if (this->columns != nullptr) {
+		throw std::runtime_error("Structs of a list are stored in columns");
+	}
 	if (index >= values.size() || index < 0) {
 		throw std::runtime_error("Index out of bounds");
 	}
@@ -34,13 +87,24 @@ Value *List::at(unsigned int index) const {
 }
 
 Value *&List::at(unsigned int index) {
+	if (this->columns != nullptr) {
+		throw std::runtime_error("Structs of a list are stored in columns");
+	}
 	if (index >= values.size() || index < 0) {
 		throw std::runtime_error("Index out of bounds");
 	}
 	return values[index];
 }
 
+/**
+ * @brief set the value at the given index, the list takes the ownership of the value except for
+ * lists of structs where the struct members are copied to the columns
+ */
 void List::set(unsigned int index, Value *value, Value **hold) {
+	if (this->columns != nullptr) {
+		this->columns->set(index, static_cast<const Struct*>(value));
+		return;
+	}
 	if (index >= values.size() || index < 0) {
 		throw std::runtime_error("Index out of bounds");
 	}
@@ -53,20 +117,33 @@ void List::set(unsigned int index, Value *value, Value **hold) {
 }
 
 void List::push(Value *value) {
+	if (this->columns != nullptr) {
+		this->columns->insert(this->columns->size(), static_cast<const Struct*>(value));
+		return;
+	}
 	value->setOwner(Value::OBJECT_VALUE);
 	this->values.push_back(value);
 }
 
 Value * List::pop() {
-	if (values.size() == 0) {
+	if (this->size() == 0) {
 		throw std::runtime_error("Cannot pop from empty list");
 	}
+	if (this->columns != nullptr) {
+		Value *value = this->columns->release(this->columns->size() - 1, this->range);
+		value->setOwner(Value::OBJECT_VALUE);
+		return value;
+	}
 	Value *value = values.back();
 	values.pop_back();
 	return value;
 }
 
 void List::insert(unsigned int index, Value *value) {
+	if (this->columns != nullptr) {
+		this->columns->insert(index, static_cast<const Struct*>(value));
+		return;
+	}
 	if (index > values.size() || index < 0) {
 		throw std::runtime_error("Index out of bounds");
 	}
@@ -74,6 +151,10 @@ void List::insert(unsigned int index, Value *value) {
 	this->values.insert(values.begin() + index, value);
 }
 void List::remove(unsigned int index) {
+	if (this->columns != nullptr) {
+		this->columns->remove(index);
+		return;
+	}
 	if (index >= values.size() || index < 0) {
 		throw std::runtime_error("Index out of bounds");
 	}
@@ -82,12 +163,120 @@ void List::remove(unsigned int index) {
 }
 
 void List::clear() {
+	if (this->columns != nullptr) {
+		this->columns->clear();
+	}
 	for (auto &value : values) {
 		Value::deleteValue(&value, Value::OBJECT_VALUE);
 	}
 	values.clear();
 }
 
+bool List::isNumeric() const {
+	if (this->columns != nullptr) {
+		return false;
+	}
+	for (auto &value : values) {
+		if (!value->isNumber()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool List::isIntegral() const {
+	if (this->columns != nullptr) {
+		return false;
+	}
+	for (auto &value : values) {
+		if (!isIntegralValue(value)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+std::vector<int64_t> List::toInts() const {
+	std::vector<int64_t> result(values.size());
+	for (size_t i = 0; i < values.size(); i++) {
+		result[i] = intValue(values[i]);
+	}
+	return result;
+}
+
+std::vector<float> List::toFloats() const {
+	std::vector<float> result(values.size());
+	for (size_t i = 0; i < values.size(); i++) {
+		result[i] = floatValue(values[i]);
+	}
+	return result;
+}
+
+/**
+ * @brief Apply an element-wise operator (.+ .- .* ./) between two numeric lists of the same size
+ * or between a numeric list and a number. The values are unboxed into contiguous buffers so the
+ * operation itself runs in the simd kernels. The result is a list of int if both operands only
+ * contain integers or booleans, a list of float otherwise.
+ * Sizes and division by zero must be checked by the caller.
+ */
+Value *List::vectorOperation(const Value *left, const Value *right, OperatorToken::OperatorTypes op, const TextRange &range) {
+	const List *leftList = left->getType() == LIST ? static_cast<const List*>(left) : nullptr;
+	const List *rightList = right->getType() == LIST ? static_cast<const List*>(right) : nullptr;
+	if (leftList == nullptr && rightList == nullptr) {
+		throw std::runtime_error("Element-wise operators need at least one list operand");
+	}
+	if ((leftList == nullptr && !left->isNumber()) || (rightList == nullptr && !right->isNumber()) ||
+		(leftList != nullptr && !leftList->isNumeric()) || (rightList != nullptr && !rightList->isNumeric())) {
+		throw std::runtime_error("Element-wise operators can only be applied to numbers");
+	}
+	size_t size = leftList != nullptr ? leftList->size() : rightList->size();
+	if (leftList != nullptr && rightList != nullptr && rightList->size() != size) {
+		throw std::runtime_error("Element-wise operators need lists of the same size");
+	}
+
+	simd::Operation operation = simd::ADD;
+	switch (op) {
+		case OperatorToken::OP_VADD:
+			operation = simd::ADD;
+			break;
+		case OperatorToken::OP_VSUB:
+			operation = simd::SUB;
+			break;
+		case OperatorToken::OP_VMUL:
+			operation = simd::MUL;
+			break;
+		case OperatorToken::OP_VDIV:
+			operation = simd::DIV;
+			break;
+		default:
+			throw std::runtime_error("Invalid element-wise operator");
+	}
+
+	std::vector<Value *> result;
+	result.reserve(size);
+	bool integral = (leftList != nullptr ? leftList->isIntegral() : isIntegralValue(left)) &&
+					(rightList != nullptr ? rightList->isIntegral() : isIntegralValue(right));
+	if (integral) {
+		std::vector<int64_t> a = leftList != nullptr ? leftList->toInts() : std::vector<int64_t>(size, intValue(left));
+		std::vector<int64_t> b = rightList != nullptr ? rightList->toInts() : std::vector<int64_t>(size, intValue(right));
+		std::vector<int64_t> out(size);
+		simd::apply(operation, a.data(), b.data(), out.data(), size);
+		for (int64_t value : out) {
+			result.push_back(new Int(value, range, Value::OBJECT_VALUE));
+		}
+		return new List(result, range, INTERPRETER, INT);
+	}
+
+	std::vector<float> a = leftList != nullptr ? leftList->toFloats() : std::vector<float>(size, floatValue(left));
+	std::vector<float> b = rightList != nullptr ? rightList->toFloats() : std::vector<float>(size, floatValue(right));
+	std::vector<float> out(size);
+	simd::apply(operation, a.data(), b.data(), out.data(), size);
+	for (float value : out) {
+		result.push_back(new Float(value, range, Value::OBJECT_VALUE));
+	}
+	return new List(result, range, INTERPRETER, FLOAT);
+}
+
 Value *List::to(ValueType type, ValueOwner owner) const {
 	if (type == LIST || type == ANY) {
 		return copy(owner);
@@ -100,6 +289,11 @@ Value *List::to(ValueType type, ValueOwner owner) const {
 	}
 }
 inline Value *List::copy(ValueOwner owner) const {
+	if (this->columns != nullptr) {
+		List *copy = new List(range, owner, this->listType, this->variableRange);
+		copy->columns = std::make_shared<StructColumns>(*this->columns);
+		return copy;
+	}
 	std::vector<Value *> newValues;
 	for (auto &value : values) {
 		newValues.push_back(value->copy(Value::OBJECT_VALUE));
@@ -112,6 +306,11 @@ inline std::string List::getStringValue() const {
 	for (auto &value : values) {
 		result += value->getStringValue() + ", ";
 	}
+	for (size_t i = 0; this->columns != nullptr && i < this->columns->size(); i++) {
+		Value *row = this->columns->gather(i, range, INTERPRETER);
+		result += row->getStringValue() + ", ";
+		Value::deleteValue(&row, INTERPRETER);
+	}
 	if (result.size() > 1) {
 		result.pop_back();
 		result.pop_back();
@@ -121,8 +320,24 @@ inline std::string List::getStringValue() const {
 }
 
 Value *List::opadd(const Value *other, const TextRange &range, const ContextPtr &context) const {
+	if (this->columns != nullptr) {
+		const List *otherList = dynamic_cast<const List*>(other);
+		if (otherList == nullptr || otherList->columns == nullptr ||
+			otherList->columns->getDefinition() != this->columns->getDefinition()) {
+			throw std::runtime_error("Cannot add element of type " + stringType(other->getType()) + " to list of " + std::get<std::string>(this->listType));
+		}
+		List *result = static_cast<List*>(this->copy());
+		result->range = range;
+		for (size_t i = 0; i < otherList->size(); i++) {
+			result->columns->append(*otherList->columns, i);
+		}
+		return result;
+	}
 	if (other->getType() == ValueType::LIST) {
-		std::vector<Value *> newValues = values;
+		std::vector<Value *> newValues;
+		for (auto &value : values) {
+			newValues.push_back(value->copy(Value::OBJECT_VALUE));
+		}
 		for (auto &value : static_cast<const List*>(other)->values) {
 			newValues.push_back(value->copy(Value::OBJECT_VALUE));
 		}
@@ -141,6 +356,16 @@ Value *List::opsub(const Value *other, const TextRange &range, const ContextPtr
 }
 
 Value *List::opmul(const Value *other, const TextRange &range, const ContextPtr &context) const {
+	if (this->columns != nullptr && other->getType() == ValueType::INT) {
+		List *result = new List(range, INTERPRETER, this->listType);
+		int valueCount = static_cast<const Int*>(other)->getValue();
+		for (int i = 0; i < valueCount; i++) {
+			for (size_t j = 0; j < this->size(); j++) {
+				result->columns->append(*this->columns, j);
+			}
+		}
+		return result;
+	}
 	if (other->getType() == ValueType::INT) {
 		std::vector<Value *> newValues;
 		int valueCount = static_cast<const Int*>(other)->getValue();
@@ -183,7 +408,26 @@ Value *List::ople(const Value *other, const TextRange &range, const ContextPtr &
 	throw std::runtime_error("Cannot compare list to element of type " + stringType(other->getType()));
 }
 
+/**
+ * @brief compare two lists of structs row by row
+ */
+bool List::columnsEqual(const Value *other, const TextRange &range, const ContextPtr &context) const {
+	const List *otherList = dynamic_cast<const List*>(other);
+	if (otherList == nullptr || otherList->columns == nullptr || otherList->size() != this->size()) {
+		return false;
+	}
+	for (size_t i = 0; i < this->size(); i++) {
+		if (!this->columns->rowEquals(i, *otherList->columns, i, range, context)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 Value *List::opne(const Value *other, const TextRange &range, const ContextPtr &context) const {
+	if (this->columns != nullptr) {
+		return new Bool(!this->columnsEqual(other, range, context), range, INTERPRETER);
+	}
 	bool result = true;
 	if (other->getType() == ValueType::LIST) {
 		const std::vector<Value*> otherList = static_cast<const List*>(other)->values;
@@ -201,6 +445,9 @@ Value *List::opne(const Value *other, const TextRange &range, const ContextPtr &
 }
 
 Value *List::opeq(const Value *other, const TextRange &range, const ContextPtr &context) const {
+	if (this->columns != nullptr) {
+		return new Bool(this->columnsEqual(other, range, context), range, INTERPRETER);
+	}
 	bool result = false;
 	if (other->getType() == ValueType::LIST) {
 		const std::vector<Value*> otherList = static_cast<const List*>(other)->values;
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
 #include "value/value.hpp"
 #include "value/types/string.hpp"
 #include "value/types/numbers/bool.hpp"
+#include "value/types/struct.hpp"
+#include "tokens/tokens/operatortoken.hpp"
 
 class List : public Value {
 	public:
@@ -18,6 +21,9 @@ class List : public Value {
 			return listType;
 		}
 
+		bool isColumnar() const;
+		std::shared_ptr<StructColumns> getColumns() const;
+
 		unsigned int size() const;
 		Value *&at(unsigned int index);
 		Value *at(unsigned int index) const;
@@ -28,6 +34,13 @@ class List : public Value {
 		void remove(unsigned int index);
 		void clear();
 
+		bool isNumeric() const;
+		bool isIntegral() const;
+		std::vector<int64_t> toInts() const;
+		std::vector<float> toFloats() const;
+
+		static Value *vectorOperation(const Value *left, const Value *right, OperatorToken::OperatorTypes op, const TextRange &range);
+
 		List *empty() {
 			return List::emptyList.get();
 		}
@@ -52,7 +65,11 @@ class List : public Value {
 		Value *opeq(const Value *other, const TextRange &range, const ContextPtr &context) const override;
 
 	private:
+		bool columnsEqual(const Value *other, const TextRange &range, const ContextPtr &context) const;
+
 		static std::unique_ptr<List> emptyList;
 		std::vector<Value *> values;
+		// lists of structs store each member in its own column instead of in values
+		std::shared_ptr<StructColumns> columns;
 		RPNBaseType listType;
 };
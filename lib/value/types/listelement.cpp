@@ -7,7 +7,14 @@ ListElement::ListElement(List *list, size_t index, TextRange range, ValueOwner o
 		}
 	}
 
-Value *&ListElement::get() const {
+/**
+ * @brief get the element value, the structs of a list are stored in columns so for them
+ * a new struct holding a copy of the element row is returned and must be deleted by the caller
+ */
+Value *ListElement::get() const {
+	if (list->isColumnar()) {
+		return list->getColumns()->gather(index, range, INTERPRETER);
+	}
 	return list->at(index);
 }
 
@@ -15,7 +22,48 @@ void ListElement::set(Value * const &value, Value **hold) {
 	this->list->set(index, value, hold);
 }
 
+List *ListElement::getList() const {
+	return this->list;
+}
+
+size_t ListElement::getIndex() const {
+	return this->index;
+}
+
+/**
+ * @brief get a member of the struct stored at the element index directly from the list columns,
+ * a scalar member is boxed in a new value owned by the interpreter
+ * 
+ * @param member the struct access path
+ * @return Value* the member value
+ */
+Value *ListElement::getMember(const Path *member) const {
+	Value *value = list->getColumns()->get(index, member->offset(0), range);
+	for (size_t i = 1; i < member->size(); i++) {
+		value = static_cast<Struct *>(value)->getMember(member->offset(i));
+	}
+	return value;
+}
+
+void ListElement::setMember(const Path *member, Value *value, Value **hold) {
+	if (member->size() == 1) {
+		list->getColumns()->set(index, member->offset(0), value, hold);
+		return;
+	}
+	Value *structValue = list->getColumns()->get(index, member->offset(0), range);
+	for (size_t i = 1; i < member->size() - 1; i++) {
+		structValue = static_cast<Struct *>(structValue)->getMember(member->offset(i));
+	}
+	static_cast<Struct *>(structValue)->setMember(member, value, hold);
+}
+
 std::string ListElement::getStringValue() const {
+	if (list->isColumnar()) {
+		Value *value = list->getColumns()->gather(index, range, INTERPRETER);
+		std::string result = value->getStringValue();
+		Value::deleteValue(&value, INTERPRETER);
+		return result;
+	}
 	return list->at(index)->getStringValue();
 }
 
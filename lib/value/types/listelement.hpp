@@ -7,9 +7,14 @@ class ListElement : public Value {
 	public:
 		ListElement(List *list, size_t index, TextRange range, ValueOwner owner);
 
-		Value *&get() const;
+		Value *get() const;
 		void set(Value * const &value, Value **hold = nullptr);
 
+		List *getList() const;
+		size_t getIndex() const;
+		Value *getMember(const Path *member) const;
+		void setMember(const Path *member, Value *value, Value **hold);
+
 		inline std::string getStringValue() const;
 
 		bool isNumber() const { return false; };
@@ -2,7 +2,7 @@
 
 None::None(TextRange range, ValueOwner owner) : Value(NONE, range, owner) {}
 
-std::unique_ptr<None> None::emptyNone = std::make_unique<None>(TextRange(), Value::EMPTY_VALUE);
+std::unique_ptr<None> None::emptyNone = std::make_unique<None>(TextRange(), Value::CONSTANT);
 
 inline std::string None::getStringValue() const {
 	return "NONE";
@@ -10,9 +10,9 @@ inline std::string None::getStringValue() const {
 
 Value *None::to(ValueType type, ValueOwner owner) const {
 	if (type == NONE || type == ANY)
-		return new None(this->range, owner);
+		return None::empty();
 	if (type == BOOL)
-		return new Bool(false, this->range, owner);
+		return Bool::create(false, this->range);
 	
 	throw std::runtime_error("Invalid value type");
 }
@@ -62,9 +62,9 @@ Value *None::ople(const Value *other, const TextRange &range, const ContextPtr &
 }
 
 Value *None::opne(const Value *other, const TextRange &range, const ContextPtr &context) const {
-	return new Bool(other->getType() != NONE, other->getRange(), Value::INTERPRETER);
+	return Bool::create(other->getType() != NONE, other->getRange());
 }
 
 Value *None::opeq(const Value *other, const TextRange &range, const ContextPtr &context) const {
-	return new Bool(other->getType() == NONE, other->getRange(), Value::INTERPRETER);
+	return Bool::create(other->getType() == NONE, other->getRange());
 }
@@ -10,18 +10,32 @@ Bool::Bool(bool value, TextRange range, ValueOwner owner, const TextRange variab
 
 std::unique_ptr<Bool> Bool::emptyBool = std::make_unique<Bool>(false, TextRange(), Value::EMPTY_VALUE);
 
+/**
+ * @brief get one of the shared CONSTANT true and false instances, they are never modified so
+ * they have no range: an error about one of them is located at the token using it
+ * 
+ * @param value the value of the boolean
+ * @param range the range of the use, the shared instances don't keep it
+ * @return Bool* the boolean
+ */
+Bool *Bool::create(bool value, TextRange range) {
+	static Bool trueConstant(true, TextRange(), Value::CONSTANT);
+	static Bool falseConstant(false, TextRange(), Value::CONSTANT);
+	return value ? &trueConstant : &falseConstant;
+}
+
 
 Value *Bool::to(ValueType type, ValueOwner owner) const {
 	switch (type) {
 		case STRING:
 			return new String(value ? "true" : "false", range, owner);
 		case INT:
-			return new Int(static_cast<int64_t>(value), range, owner);
+			return Int::create(static_cast<int64_t>(value), range, owner);
 		case FLOAT:
 			return new Float(static_cast<float>(value), range, owner);
 		case BOOL:
 		case ANY:
-			return new Bool(this->value, this->range, owner);
+			return Bool::create(this->value, this->range);
 		default:
 			throw std::runtime_error("Invalid value type");
 	};
@@ -38,9 +52,9 @@ inline std::string Bool::getStringValue() const {
 Value *Bool::opadd(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(value + static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value + static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(value + static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value + static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(value + static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
 		default:
@@ -51,9 +65,9 @@ Value *Bool::opadd(const Value *other, const TextRange &range, const ContextPtr
 Value *Bool::opsub(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(value - static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value - static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(value - static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value - static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(value - static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
 		default:
@@ -64,9 +78,9 @@ Value *Bool::opsub(const Value *other, const TextRange &range, const ContextPtr
 Value *Bool::opmul(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(value * static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value * static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(value * static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value * static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(value * static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
 		default:
@@ -77,9 +91,9 @@ Value *Bool::opmul(const Value *other, const TextRange &range, const ContextPtr
 Value *Bool::opdiv(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(value / static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value / static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(value / static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value / static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(value / static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
 		default:
@@ -90,9 +104,9 @@ Value *Bool::opdiv(const Value *other, const TextRange &range, const ContextPtr
 Value *Bool::opmod(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT: 
-			return new Int(value % static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value % static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(value % static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value % static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(std::fmod(value, static_cast<Float const*>(other)->getValue()), range, Value::INTERPRETER);
 		default:
@@ -103,9 +117,9 @@ Value *Bool::opmod(const Value *other, const TextRange &range, const ContextPtr
 Value *Bool::oppow(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(std::pow(value, static_cast<Int const*>(other)->getValue()), range, Value::INTERPRETER);
+			return Int::create(std::pow(value, static_cast<Int const*>(other)->getValue()), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(std::pow(value, static_cast<Bool const*>(other)->getValue()), range, Value::INTERPRETER);
+			return Int::create(std::pow(value, static_cast<Bool const*>(other)->getValue()), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(std::pow(value, static_cast<Float const*>(other)->getValue()), range, Value::INTERPRETER);
 		default:
@@ -116,11 +130,11 @@ Value *Bool::oppow(const Value *other, const TextRange &range, const ContextPtr
 Value *Bool::opgt(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value > static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value > static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value > static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value > static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value > static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value > static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Bool");
 	};
@@ -129,11 +143,11 @@ Value *Bool::opgt(const Value *other, const TextRange &range, const ContextPtr &
 Value *Bool::opge(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value >= static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value >= static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value >= static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value >= static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value >= static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value >= static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Bool");
 	};
@@ -142,11 +156,11 @@ Value *Bool::opge(const Value *other, const TextRange &range, const ContextPtr &
 Value *Bool::oplt(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value < static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value < static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value < static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value < static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value < static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value < static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Bool");
 	};
@@ -155,11 +169,11 @@ Value *Bool::oplt(const Value *other, const TextRange &range, const ContextPtr &
 Value *Bool::ople(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value <= static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value <= static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value <= static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value <= static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value <= static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value <= static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Bool");
 	};
@@ -168,25 +182,25 @@ Value *Bool::ople(const Value *other, const TextRange &range, const ContextPtr &
 Value *Bool::opne(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value != static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value != static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value != static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value != static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value != static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value != static_cast<Float const*>(other)->getValue(), range);
 		default:
-			return new Bool(true, range, Value::INTERPRETER);
+			return Bool::create(true, range);
 	};
 }
 
 Value *Bool::opeq(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value == static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value == static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value == static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value == static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value == static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value == static_cast<Float const*>(other)->getValue(), range);
 		default:
-			return new Bool(false, range, Value::INTERPRETER);
+			return Bool::create(false, range);
 	};
 }
\ No newline at end of file
@@ -27,6 +27,7 @@ class Bool : public Value {
 		static Bool *empty() {
 			return Bool::emptyBool.get();
 		}
+		static Bool *create(bool value, TextRange range);
 
 		inline std::string getStringValue() const;
 
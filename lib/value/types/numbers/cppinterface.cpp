@@ -171,42 +171,42 @@ CPPInterface& operator^=(CPPInterface& left, const CPPInterface& right) {
 bool operator==(const CPPInterface& left, const Value* right) {
 	Value *result = left.getValue()->opeq(right, TextRange(), nullptr);
 	bool comp = static_cast<Bool *>(result)->getValue();
-	delete result;
+	Value::deleteValue(&result, Value::INTERPRETER);
 	return comp;
 }
 
 bool operator!=(const CPPInterface& left, const Value* right) {
 	Value *result = left.getValue()->opne(right, TextRange(), nullptr);
 	bool comp = static_cast<Bool *>(result)->getValue();
-	delete result;
+	Value::deleteValue(&result, Value::INTERPRETER);
 	return comp;
 }
 
 bool operator< (const CPPInterface& left, const Value* right) {
 	Value *result = left.getValue()->oplt(right, TextRange(), nullptr);
 	bool comp = static_cast<Bool *>(result)->getValue();
-	delete result;
+	Value::deleteValue(&result, Value::INTERPRETER);
 	return comp;
 }
 
 bool operator> (const CPPInterface& left, const Value* right) {
 	Value *result = left.getValue()->opgt(right, TextRange(), nullptr);
 	bool comp = static_cast<Bool *>(result)->getValue();
-	delete result;
+	Value::deleteValue(&result, Value::INTERPRETER);
 	return comp;
 }
 
 bool operator<=(const CPPInterface& left, const Value* right) {
 	Value *result = left.getValue()->ople(right, TextRange(), nullptr);
 	bool comp = static_cast<Bool *>(result)->getValue();
-	delete result;
+	Value::deleteValue(&result, Value::INTERPRETER);
 	return comp;
 }
 
 bool operator>=(const CPPInterface& left, const Value* right) {
 	Value *result = left.getValue()->opge(right, TextRange(), nullptr);
 	bool comp = static_cast<Bool *>(result)->getValue();
-	delete result;
+	Value::deleteValue(&result, Value::INTERPRETER);
 	return comp;
 }
 
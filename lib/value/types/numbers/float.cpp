@@ -16,12 +16,12 @@ Value *Float::to(ValueType type, ValueOwner owner) const {
 		case STRING:
 			return new String(std::to_string(value), range, owner);
 		case INT:
-			return new Int(static_cast<int64_t>(value), range, owner);
+			return Int::create(static_cast<int64_t>(value), range, owner);
 		case FLOAT:
 		case ANY:
 			return new Float(this->value, this->range, owner);
 		case BOOL:
-			return new Bool(value != 0, range, owner);
+			return Bool::create(value != 0, range);
 		default:
 			throw std::runtime_error("Invalid value type");
 	};
@@ -120,11 +120,11 @@ Value *Float::oppow(const Value *other, const TextRange &range, const ContextPtr
 Value *Float::opgt(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value > static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value > static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value > static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value > static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value > static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value > static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Float");
 	};
@@ -133,11 +133,11 @@ Value *Float::opgt(const Value *other, const TextRange &range, const ContextPtr
 Value *Float::opge(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value >= static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value >= static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value >= static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value >= static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value >= static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value >= static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Float");
 	};
@@ -146,11 +146,11 @@ Value *Float::opge(const Value *other, const TextRange &range, const ContextPtr
 Value *Float::oplt(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value < static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value < static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value < static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value < static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value < static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value < static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Float");
 	};
@@ -159,11 +159,11 @@ Value *Float::oplt(const Value *other, const TextRange &range, const ContextPtr
 Value *Float::ople(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value <= static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value <= static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value <= static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value <= static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value <= static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value <= static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Float");
 	};
@@ -172,25 +172,25 @@ Value *Float::ople(const Value *other, const TextRange &range, const ContextPtr
 Value *Float::opne(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value != static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value != static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value != static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value != static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value != static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value != static_cast<Float const*>(other)->getValue(), range);
 		default:
-			return new Bool(true, range, Value::INTERPRETER);
+			return Bool::create(true, range);
 	};
 }
 
 Value *Float::opeq(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value == static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value == static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value == static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value == static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value == static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value == static_cast<Float const*>(other)->getValue(), range);
 		default:
-			return new Bool(false, range, Value::INTERPRETER);
+			return Bool::create(false, range);
 	};
 }
\ No newline at end of file
@@ -10,17 +10,43 @@ Int::Int(int64_t value, TextRange range, ValueOwner owner, const TextRange varia
 
 std::unique_ptr<Int> Int::emptyInt = std::make_unique<Int>(0, TextRange(), Value::EMPTY_VALUE);
 
+/**
+ * @brief get an integer value, values between RPN_SMALL_INT_MIN and RPN_SMALL_INT_MAX are shared
+ * CONSTANT instances so the owner is only used for the other values. The shared instances are
+ * never modified, even by other threads, so they have no range: an error about one of them is
+ * located at the token using it
+ * 
+ * @param value the value of the integer
+ * @param range the range of the value
+ * @param owner the owner of the value if it is not a shared one
+ * @return Int* the integer
+ */
+Int *Int::create(int64_t value, TextRange range, ValueOwner owner) {
+	if (value < RPN_SMALL_INT_MIN || value > RPN_SMALL_INT_MAX) {
+		return new Int(value, range, owner);
+	}
+	static const std::vector<std::unique_ptr<Int>> constants = [] {
+		std::vector<std::unique_ptr<Int>> constants;
+		for (int64_t i = RPN_SMALL_INT_MIN; i <= RPN_SMALL_INT_MAX; i++) {
+			constants.push_back(std::make_unique<Int>(i, TextRange(), Value::CONSTANT));
+		}
+		return constants;
+	}();
+	return constants[value - RPN_SMALL_INT_MIN].get();
+}
+
 Value *Int::to(ValueType type, ValueOwner owner) const {
 	switch (type) {
 		case STRING:
 			return new String(std::to_string(value), range, owner);
 		case INT:
 		case ANY:
-			return new Int(value, range, owner);
+			// a small integer is a shared CONSTANT whatever the owner asked for
+			return Int::create(value, range, owner);
 		case FLOAT:
 			return new Float(static_cast<float>(value), range, owner);
 		case BOOL:
-			return new Bool(value != 0, range, owner);
+			return Bool::create(value != 0, range);
 		default:
 			throw std::runtime_error("Invalid value type");
 	};
@@ -37,9 +63,9 @@ inline std::string Int::getStringValue() const {
 Value *Int::opadd(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(value + static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value + static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(value + static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value + static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(value + static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
 		default:
@@ -50,9 +76,9 @@ Value *Int::opadd(const Value *other, const TextRange &range, const ContextPtr &
 Value *Int::opsub(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(value - static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value - static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(value - static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value - static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(value - static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
 		default:
@@ -63,9 +89,9 @@ Value *Int::opsub(const Value *other, const TextRange &range, const ContextPtr &
 Value *Int::opmul(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(value * static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value * static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(value * static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value * static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(value * static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
 		default:
@@ -76,9 +102,9 @@ Value *Int::opmul(const Value *other, const TextRange &range, const ContextPtr &
 Value *Int::opdiv(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(value / static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value / static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(value / static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value / static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(value / static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
 		default:
@@ -89,9 +115,9 @@ Value *Int::opdiv(const Value *other, const TextRange &range, const ContextPtr &
 Value *Int::opmod(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(value % static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value % static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(value % static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Int::create(value % static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(std::fmod(value, static_cast<Float const*>(other)->getValue()), range, Value::INTERPRETER);
 		default:
@@ -102,9 +128,9 @@ Value *Int::opmod(const Value *other, const TextRange &range, const ContextPtr &
 Value *Int::oppow(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Int(std::pow(value, static_cast<Int const*>(other)->getValue()), range, Value::INTERPRETER);
+			return Int::create(std::pow(value, static_cast<Int const*>(other)->getValue()), range, Value::INTERPRETER);
 		case BOOL:
-			return new Int(std::pow(value, static_cast<Bool const*>(other)->getValue()), range, Value::INTERPRETER);
+			return Int::create(std::pow(value, static_cast<Bool const*>(other)->getValue()), range, Value::INTERPRETER);
 		case FLOAT:
 			return new Float(std::pow(value, static_cast<Float const*>(other)->getValue()), range, Value::INTERPRETER);
 		default:
@@ -115,11 +141,11 @@ Value *Int::oppow(const Value *other, const TextRange &range, const ContextPtr &
 Value *Int::opgt(const Value *other, const TextRange &range, const ContextPtr &context) const {	
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value > static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value > static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value > static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value > static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value > static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value > static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Int");
 	};
@@ -128,11 +154,11 @@ Value *Int::opgt(const Value *other, const TextRange &range, const ContextPtr &c
 Value *Int::opge(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value >= static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value >= static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value >= static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value >= static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value >= static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value >= static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Int");
 	};
@@ -141,11 +167,11 @@ Value *Int::opge(const Value *other, const TextRange &range, const ContextPtr &c
 Value *Int::oplt(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value < static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value < static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value < static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value < static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value < static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value < static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Int");
 	};
@@ -154,11 +180,11 @@ Value *Int::oplt(const Value *other, const TextRange &range, const ContextPtr &c
 Value *Int::ople(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value <= static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value <= static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value <= static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value <= static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value <= static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value <= static_cast<Float const*>(other)->getValue(), range);
 		default:
 			throw std::runtime_error("Cannot compare value of type " + other->getStringType() + " to Int");
 	};
@@ -167,25 +193,25 @@ Value *Int::ople(const Value *other, const TextRange &range, const ContextPtr &c
 Value *Int::opne(const Value *other, const TextRange &range, const ContextPtr &context) const {
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value != static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value != static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value != static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value != static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value != static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value != static_cast<Float const*>(other)->getValue(), range);
 		default:
-			return new Bool(true, range, Value::INTERPRETER);
+			return Bool::create(true, range);
 	};
 }
 
 Value *Int::opeq(const Value *other, const TextRange &range, const ContextPtr &context) const {	
 	switch (other->getType()) {
 		case INT:
-			return new Bool(value == static_cast<Int const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value == static_cast<Int const*>(other)->getValue(), range);
 		case BOOL:
-			return new Bool(value == static_cast<Bool const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value == static_cast<Bool const*>(other)->getValue(), range);
 		case FLOAT:
-			return new Bool(value == static_cast<Float const*>(other)->getValue(), range, Value::INTERPRETER);
+			return Bool::create(value == static_cast<Float const*>(other)->getValue(), range);
 		default:
-			return new Bool(false, range, Value::INTERPRETER);
+			return Bool::create(false, range);
 	};
 }
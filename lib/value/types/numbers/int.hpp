@@ -13,6 +13,14 @@ class Float;
 class String;
 #include "value/types/string.hpp"
 
+// bounds of the shared integer instances, configured by CMake
+#ifndef RPN_SMALL_INT_MIN
+#define RPN_SMALL_INT_MIN -128
+#endif
+#ifndef RPN_SMALL_INT_MAX
+#define RPN_SMALL_INT_MAX 1023
+#endif
+
 
 class Int : public Value {
 	public:
@@ -27,6 +35,7 @@ class Int : public Value {
 		static Int *empty() {
 			return Int::emptyInt.get();
 		}
+		static Int *create(int64_t value, TextRange range, ValueOwner owner = INTERPRETER);
 
 		std::string getStringValue() const override;
 
@@ -3,7 +3,8 @@
 
 Path::Path(std::vector<std::string> path, TextRange range, ValueType type) :
 	Value(type, range, Value::VALUE_TOKEN),
-	path(path) {}
+	path(path),
+	symbols(path.begin(), path.end()) {}
 
 std::vector<std::string> Path::getPath() const {
 	return this->path;
@@ -17,10 +18,26 @@ std::string Path::ats(size_t index) const {
 	return this->path.at(index);
 }
 
+Symbol Path::symbol(size_t index) const {
+	return this->symbols.at(index);
+}
+
 size_t Path::size() const {
 	return this->path.size();
 }
 
+void Path::setOffsets(std::vector<size_t> offsets) {
+	this->offsets = std::move(offsets);
+}
+
+const std::vector<size_t> &Path::getOffsets() const {
+	return this->offsets;
+}
+
+size_t Path::offset(size_t index) const {
+	return this->offsets[index];
+}
+
 bool Path::isNumber() const {
 	return false;
 }
@@ -34,7 +51,9 @@ inline std::string Path::getStringValue() const {
 }
 
 Value* Path::copy(ValueOwner owner) const {
-	return new Path(this->path, this->range, this->type);
+	Path *copy = new Path(this->path, this->range, this->type);
+	copy->offsets = this->offsets;
+	return copy;
 }
 
 Value *Path::opadd(const Value *other, const TextRange &range, const ContextPtr &context) const {
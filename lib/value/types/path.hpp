@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "value/value.hpp"
+#include "textutilities/symbol.hpp"
 #include "textutilities/textutilities.hpp"
 
 class Path : public Value {
@@ -19,8 +20,13 @@ class Path : public Value {
 		std::vector<std::string> getPath() const;
 		std::string_view at(size_t index) const;
 		std::string ats(size_t index) const;
+		Symbol symbol(size_t index) const;
 		size_t size() const;
 
+		void setOffsets(std::vector<size_t> offsets);
+		const std::vector<size_t> &getOffsets() const;
+		size_t offset(size_t index) const;
+
 		Value *opadd(const Value *other, const TextRange &range, const ContextPtr &context) const override;
 		Value *opsub(const Value *other, const TextRange &range, const ContextPtr &context) const override;
 		Value *opmul(const Value *other, const TextRange &range, const ContextPtr &context) const override;
@@ -36,4 +42,7 @@ class Path : public Value {
 	
 	private:
 		std::vector<std::string> path;
+		std::vector<Symbol> symbols;
+		// struct member slots of each path element, resolved by the analyzer for struct accesses
+		std::vector<size_t> offsets;
 };
\ No newline at end of file
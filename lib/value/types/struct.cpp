@@ -4,34 +4,43 @@ StructDefinition::StructDefinition(std::string_view name) : name(name) {}
 
 StructDefinition::StructDefinition(const StructDefinition &other) :
 	name(other.name),
-	members(other.members),
+	memberIndexes(other.memberIndexes),
+	memberTypes(other.memberTypes),
 	memberOrder(other.memberOrder) {}
 
 StructDefinition::StructDefinition(StructDefinition &&other) : 
 	name(std::move(other.name)),
-	members(std::move(other.members)),
+	memberIndexes(std::move(other.memberIndexes)),
+	memberTypes(std::move(other.memberTypes)),
 	memberOrder(std::move(other.memberOrder)) {}
 
 
-void StructDefinition::operator=(StructDefinition &other) {
+void StructDefinition::operator=(const StructDefinition &other) {
 	this->name = other.name;
-	this->members = other.members;
+	this->memberIndexes = other.memberIndexes;
+	this->memberTypes = other.memberTypes;
 	this->memberOrder = other.memberOrder;
 }
 
 void StructDefinition::addMember(std::string_view name, RPNValueType type) {
 	std::string nameStr = std::string(name);
-	this->members[nameStr] = type;
-	this->memberOrder.push_back(nameStr.data());
+	auto it = this->memberIndexes.find(nameStr);
+	if (it != this->memberIndexes.end()) {
+		this->memberTypes[it->second] = type;
+		return;
+	}
+	this->memberIndexes[nameStr] = this->memberOrder.size();
+	this->memberTypes.push_back(type);
+	this->memberOrder.push_back(nameStr);
 }
 
 bool StructDefinition::hasMember(std::string_view name, RPNValueType *memberType) const {
-	auto it = this->members.find(std::string(name));
-	if (it == this->members.end()) {
+	auto it = this->memberIndexes.find(std::string(name));
+	if (it == this->memberIndexes.end()) {
 		return false;
 	}
 	if (memberType != nullptr) {
-		*memberType = it->second;
+		*memberType = this->memberTypes[it->second];
 	}
 	return true;
 }
@@ -41,7 +50,7 @@ std::string StructDefinition::getName() const {
 }
 
 size_t StructDefinition::getMembersCount() const {
-	return this->members.size();
+	return this->memberOrder.size();
 }
 
 std::vector<std::string> StructDefinition::getMembersOrder() const {
@@ -49,13 +58,27 @@ std::vector<std::string> StructDefinition::getMembersOrder() const {
 }
 
 RPNValueType StructDefinition::getMemberType(std::string_view name) const {
-	return this->members.at(std::string(name));
+	return this->memberTypes[this->getMemberIndex(name)];
+}
+
+RPNValueType StructDefinition::getMemberType(size_t index) const {
+	return this->memberTypes.at(index);
+}
+
+/**
+ * @brief get the slot of a member in the struct instances
+ * 
+ * @param name the name of the member
+ * @return size_t the index of the member
+ */
+size_t StructDefinition::getMemberIndex(std::string_view name) const {
+	return this->memberIndexes.at(std::string(name));
 }
 
 void StructDefinition::display(std::ostream &stream) const {
-	for (const std::string &key : this->memberOrder) {
-		stream << "\t" << key << " -> ";
-		stream << this->members.at(key).name();
+	for (size_t i = 0; i < this->memberOrder.size(); i++) {
+		stream << "\t" << this->memberOrder[i] << " -> ";
+		stream << this->memberTypes[i].name();
 		stream << std::endl;
 	}
 }
@@ -70,13 +93,19 @@ std::ostream &operator<<(std::ostream &stream, const StructDefinition &definitio
 Struct::Struct(TextRange range, std::string_view name, ValueOwner owner, bool immutable) :
 	Value(STRUCT, range, owner), 
 	immutable(immutable),
-	definition(&definitions[std::string(name)]),
-	members(std::make_shared<std::unordered_map<std::string, Value*>>()) {}
+	definition(&definitions()[Symbol(name)]),
+	members(std::make_shared<std::vector<Value*>>(this->definition->getMembersCount(), nullptr)) {}
+
+Struct::Struct(TextRange range, const StructDefinition *definition, std::shared_ptr<std::vector<Value*>> members, ValueOwner owner) :
+	Value(STRUCT, range, owner),
+	immutable(false),
+	definition(definition),
+	members(std::move(members)) {}
 
 Struct::~Struct() {
 	if (this->members.use_count() != 1) return;
-	for (auto &pair : *this->members) {
-		Value::deleteValue(&pair.second, OBJECT_VALUE);
+	for (auto &member : *this->members) {
+		Value::deleteValue(&member, OBJECT_VALUE);
 	}
 }
 
@@ -88,25 +117,23 @@ Struct::~Struct() {
  * @return ExpressionResult if all the values are correct
  */
 ExpressionResult Struct::setMembers(std::vector<Value*> members, ContextPtr context) {
-	if (members.size() != this->definition->members.size()) {
-		throw std::runtime_error("Member count mismatch, expected " + std::to_string(this->definition->members.size()) + " but " + std::to_string(members.size()) + " were given");
+	if (members.size() != this->members->size()) {
+		throw std::runtime_error("Member count mismatch, expected " + std::to_string(this->members->size()) + " but " + std::to_string(members.size()) + " were given");
 	}
-	auto it = members.begin();
-	for (const std::string &key : this->definition->memberOrder) {
-		RPNValueType type = this->definition->members.at(key);
+	for (size_t i = 0; i < members.size(); i++) {
+		RPNValueType type = this->definition->memberTypes[i];
 		if (type.index() == 0) {
-			(*this->members)[key] = (*it)->copy(OBJECT_VALUE);
+			(*this->members)[i] = members[i]->copy(OBJECT_VALUE);
 		} else {
-			(*this->members)[key] =
-				(*it)->to(std::get<ValueType>(type.getType()), Value::OBJECT_VALUE);
+			(*this->members)[i] =
+				members[i]->to(std::get<ValueType>(type.getType()), Value::OBJECT_VALUE);
 		}
-		it++;
 	}
 	return ExpressionResult();
 }
 
 void Struct::setMember(const Path *member, Value *value, Value **hold) {
-	Value **memberValue = &this->members->at(member->ats(member->size() - 1));
+	Value **memberValue = &this->getMember(member);
 	if (hold != nullptr) {
 		*hold = *memberValue;
 		Value::deleteValue(memberValue, Value::OBJECT_VALUE);
@@ -115,19 +142,34 @@ void Struct::setMember(const Path *member, Value *value, Value **hold) {
 	*memberValue = value;
 }
 
+/**
+ * @brief get the member targeted by the last element of a struct access path, the slot
+ * offsets of the path are resolved by the analyzer so this is a single indexed load
+ * 
+ * @param member the struct access path
+ * @return Value*& the member value
+ */
 Value *&Struct::getMember(const Path *member) {
-	return this->members->at(member->ats(member->size() - 1));
+	return this->getMember(member->offset(member->size() - 1));
+}
+
+Value *&Struct::getMember(size_t index) {
+	return (*this->members)[index];
+}
+
+Value *Struct::getMember(size_t index) const {
+	return (*this->members)[index];
 }
 
 void Struct::setMember(std::string_view member, Value *value) {
-	Value **memberValue = &(*this->members)[std::string(member)];
+	Value **memberValue = &this->getMember(this->definition->getMemberIndex(member));
 	Value::deleteValue(memberValue, Value::OBJECT_VALUE);
 	value->setOwner(Value::OBJECT_VALUE);
 	*memberValue = value;
 }
 
 Value *&Struct::getMember(std::string_view member) {
-	return this->members->at(std::string(member));
+	return this->getMember(this->definition->getMemberIndex(member));
 }
 
 bool Struct::isNumber() const {
@@ -142,19 +184,18 @@ Value *Struct::to(ValueType type, ValueOwner owner) const {
 }
 
 inline Value *Struct::copy(ValueOwner owner) const {
-	Struct *copy = new Struct(this->getRange(), this->definition->name, owner);
-	copy->members = this->members;
+	Struct *copy = new Struct(this->getRange(), this->definition, this->members, owner);
 	copy->immutable = this->immutable;
 	copy->data = this->data;
 	return copy;
 }
 
-inline std::string Struct::getStringValue() const {
+std::string Struct::getStringValue() const {
 	std::stringstream stream;
 	stream << "Struct " << this->definition->name << " ";
 	for (size_t i = 0; i < this->definition->memberOrder.size(); i++) {
 		stream << this->definition->memberOrder[i] << " -> ";
-		stream << this->members->at(this->definition->memberOrder[i])->getStringValue();
+		stream << this->getMember(i)->getStringValue();
 		if (i < this->definition->memberOrder.size() - 1) {
 			stream << "; ";
 		}
@@ -175,30 +216,34 @@ std::shared_ptr<void> Struct::getData() const {
 	return this->data;
 }
 
-std::unordered_map<std::string, StructDefinition> Struct::definitions;
-
 void Struct::addStructDefinition(StructDefinition &definition) {
-	Struct::definitions[definition.name] = definition;
+	Struct::definitions()[definition.name] = definition;
 }
 
 int Struct::getStructMembersCount(std::string_view structName) {
-	return Struct::definitions[std::string(structName)].members.size();
+	return Struct::definitions()[Symbol(structName)].getMembersCount();
 }
 
 bool Struct::structExists(std::string_view name) {
-	return Struct::definitions.find(std::string(name)) != Struct::definitions.end();
+	return Struct::definitions().contains(Symbol(name));
 }
 
-StructDefinition Struct::getStructDefinition(std::string_view structName) {
-	return Struct::definitions.at(std::string(structName));
+const StructDefinition &Struct::getStructDefinition(std::string_view structName) {
+	return Struct::definitions().at(Symbol(structName));
 }
 
-Value *&Struct::getStruct(const Value *name, const Path *path, const ContextPtr &context) {
-	Value *&structValue = context->getValue(name);
-	
+/**
+ * @brief get the struct which holds the member targeted by a struct access path
+ * 
+ * @param name the name of the variable holding the root struct
+ * @param path the struct access path
+ * @param context the context where the variable is stored
+ * @return Value* the struct holding the last member of the path
+ */
+Value *Struct::getStruct(const Value *name, const Path *path, const ContextPtr &context) {
+	Value *structValue = context->getValue(name);
 	for (size_t i = 0; i < path->size() - 1; i++) {
-		Value *value = static_cast<Struct *>(structValue)->getMember(path);
-		structValue = value;
+		structValue = static_cast<Struct *>(structValue)->getMember(path->offset(i));
 	}
 	return structValue;
 }
@@ -253,9 +298,8 @@ Value *Struct::opne(const Value *other, const TextRange &range, const ContextPtr
 	if (this->definition->name != otherStruct->definition->name) {
 		return new Bool(true, this->getRange(), Value::INTERPRETER);
 	}
-	for (auto it = this->members->begin(); it != this->members->end(); it++) {
-		auto otherIt = otherStruct->members->find(it->first);
-		Value *result = it->second->opne(otherIt->second, range, context);
+	for (size_t i = 0; i < this->definition->getMembersCount(); i++) {
+		Value *result = this->getMember(i)->opne(otherStruct->getMember(i), range, context);
 		if (static_cast<Bool*>(result)->getValue()) {
 			return result;
 		}
@@ -271,12 +315,370 @@ Value *Struct::opeq(const Value *other, const TextRange &range, const ContextPtr
 	if (this->definition->name != otherStruct->definition->name) {
 		return new Bool(false, this->getRange(), Value::INTERPRETER);
 	}
-	for (auto it = this->members->begin(); it != this->members->end(); it++) {
-		auto otherIt = otherStruct->members->find(it->first);
-		Value *result = it->second->opeq(otherIt->second, range, context);
+	for (size_t i = 0; i < this->definition->getMembersCount(); i++) {
+		Value *result = this->getMember(i)->opeq(otherStruct->getMember(i), range, context);
 		if (!static_cast<Bool*>(result)->getValue()) {
 			return result;
 		}
 	}
 	return new Bool(true, this->getRange(), Value::INTERPRETER);
-}
\ No newline at end of file
+}
+
+StructColumns::StructColumns(std::string_view structName) :
+	definition(&Struct::definitions()[Symbol(structName)]),
+	columns(this->definition->getMembersCount()),
+	rows(0) {
+	for (size_t i = 0; i < this->columns.size(); i++) {
+		const RPNValueType type = this->definition->getMemberType(i);
+		if (type.index() == 1) {
+			const ValueType valueType = std::get<ValueType>(type.getType());
+			if (valueType == INT || valueType == FLOAT || valueType == BOOL) {
+				this->columns[i].type = valueType;
+			}
+		}
+	}
+}
+
+StructColumns::StructColumns(const StructColumns &other) :
+	definition(other.definition),
+	columns(other.columns),
+	data(other.data),
+	rows(other.rows) {
+	for (Column &column : this->columns) {
+		for (Value *&value : column.values) {
+			value = value->copy(Value::OBJECT_VALUE);
+		}
+	}
+}
+
+StructColumns::~StructColumns() {
+	this->clear();
+}
+
+const StructDefinition *StructColumns::getDefinition() const {
+	return this->definition;
+}
+
+size_t StructColumns::size() const {
+	return this->rows;
+}
+
+/**
+ * @brief read a member of a row, an unboxed member is boxed in a new value owned by the
+ * interpreter while a boxed member is returned as is and stays owned by the list
+ * 
+ * @param row the row to read
+ * @param member the index of the member
+ * @param range the range of the created value
+ * @return Value* the member value
+ */
+Value *StructColumns::get(size_t row, size_t member, const TextRange &range) const {
+	if (row >= this->rows) {
+		throw std::runtime_error("Index out of bounds");
+	}
+	const Column &column = this->columns[member];
+	if (column.type == ANY) {
+		return column.values[row];
+	}
+	return this->getCell(column, row, range, Value::INTERPRETER);
+}
+
+/**
+ * @brief replace a member of a row, the list takes the ownership of the value. An unboxed member
+ * only keeps the number so the value is deleted
+ * 
+ * @param row the row to modify
+ * @param member the index of the member
+ * @param value the new member value
+ * @param hold receive the replaced value which is deleted, nullptr for an unboxed member
+ */
+void StructColumns::set(size_t row, size_t member, Value *value, Value **hold) {
+	if (row >= this->rows) {
+		throw std::runtime_error("Index out of bounds");
+	}
+	Column &column = this->columns[member];
+	if (column.type != ANY) {
+		this->storeCell(column, row, value);
+		Value::deleteValue(&value, Value::INTERPRETER);
+		if (hold != nullptr) {
+			*hold = nullptr;
+		}
+		return;
+	}
+	if (hold != nullptr) {
+		*hold = column.values[row];
+	}
+	Value::deleteValue(&column.values[row], Value::OBJECT_VALUE);
+	value->setOwner(Value::OBJECT_VALUE);
+	column.values[row] = value;
+}
+
+std::shared_ptr<void> StructColumns::getData(size_t row) const {
+	return this->data.at(row);
+}
+
+void StructColumns::setData(size_t row, const std::shared_ptr<void> &data) {
+	this->data.at(row) = data;
+}
+
+void StructColumns::checkDefinition(const Struct *value) const {
+	if (value->definition != this->definition) {
+		throw std::runtime_error("Cannot store struct " + std::string(value->getStructName()) +
+								 " in a list of " + this->definition->getName());
+	}
+}
+
+/**
+ * @brief insert a cell in a column, the value is copied or unboxed
+ */
+void StructColumns::insertCell(Column &column, size_t row, const Value *value) {
+	switch (column.type) {
+		case INT:
+			column.ints.insert(column.ints.begin() + row, 0);
+			break;
+		case FLOAT:
+			column.floats.insert(column.floats.begin() + row, 0);
+			break;
+		case BOOL:
+			column.bools.insert(column.bools.begin() + row, 0);
+			break;
+		default:
+			column.values.insert(column.values.begin() + row, value->copy(Value::OBJECT_VALUE));
+			return;
+	}
+	this->storeCell(column, row, value);
+}
+
+/**
+ * @brief write a number in an unboxed cell, a value of another type is converted first
+ */
+void StructColumns::storeCell(Column &column, size_t row, const Value *value) {
+	Value *converted = nullptr;
+	if (value->getType() != column.type) {
+		converted = value->to(column.type, Value::INTERPRETER);
+		value = converted;
+	}
+	switch (column.type) {
+		case INT:
+			column.ints[row] = static_cast<const Int *>(value)->getValue();
+			break;
+		case FLOAT:
+			column.floats[row] = static_cast<const Float *>(value)->getValue();
+			break;
+		case BOOL:
+			column.bools[row] = static_cast<const Bool *>(value)->getValue();
+			break;
+		default:
+			throw std::runtime_error("The column of a boxed member has no unboxed cell");
+	}
+	Value::deleteValue(&converted, Value::INTERPRETER);
+}
+
+Value *StructColumns::getCell(const Column &column, size_t row, const TextRange &range,
+							  Value::ValueOwner owner) const {
+	switch (column.type) {
+		case INT:
+			return Int::create(column.ints[row], range, owner);
+		case FLOAT:
+			return new Float(column.floats[row], range, owner);
+		case BOOL:
+			return Bool::create(column.bools[row] != 0, range);
+		default:
+			return column.values[row]->copy(owner);
+	}
+}
+
+void StructColumns::eraseCell(Column &column, size_t row) {
+	switch (column.type) {
+		case INT:
+			column.ints.erase(column.ints.begin() + row);
+			break;
+		case FLOAT:
+			column.floats.erase(column.floats.begin() + row);
+			break;
+		case BOOL:
+			column.bools.erase(column.bools.begin() + row);
+			break;
+		default:
+			column.values.erase(column.values.begin() + row);
+			break;
+	}
+}
+
+void StructColumns::insert(size_t row, const Struct *value) {
+	if (row > this->rows) {
+		throw std::runtime_error("Index out of bounds");
+	}
+	this->checkDefinition(value);
+	for (size_t i = 0; i < this->columns.size(); i++) {
+		this->insertCell(this->columns[i], row, value->getMember(i));
+	}
+	this->data.insert(this->data.begin() + row, value->getData());
+	this->rows++;
+}
+
+/**
+ * @brief copy a row of another list of the same struct at the end of the columns, the unboxed
+ * members are copied without creating values
+ * 
+ * @param other the columns to copy the row from, they can be these columns
+ * @param row the row to copy
+ */
+void StructColumns::append(const StructColumns &other, size_t row) {
+	if (other.definition != this->definition) {
+		throw std::runtime_error("Cannot store struct " + other.definition->getName() +
+								 " in a list of " + this->definition->getName());
+	}
+	for (size_t i = 0; i < this->columns.size(); i++) {
+		Column &column = this->columns[i];
+		const Column &otherColumn = other.columns[i];
+		switch (column.type) {
+			case INT:
+				column.ints.push_back(otherColumn.ints[row]);
+				break;
+			case FLOAT:
+				column.floats.push_back(otherColumn.floats[row]);
+				break;
+			case BOOL:
+				column.bools.push_back(otherColumn.bools[row]);
+				break;
+			default:
+				column.values.push_back(otherColumn.values[row]->copy(Value::OBJECT_VALUE));
+				break;
+		}
+	}
+	this->data.push_back(other.data[row]);
+	this->rows++;
+}
+
+void StructColumns::set(size_t row, const Struct *value) {
+	if (row >= this->rows) {
+		throw std::runtime_error("Index out of bounds");
+	}
+	this->checkDefinition(value);
+	for (size_t i = 0; i < this->columns.size(); i++) {
+		Column &column = this->columns[i];
+		if (column.type != ANY) {
+			this->storeCell(column, row, value->getMember(i));
+			continue;
+		}
+		// copied before the old member is deleted in case the new value is a part of it
+		Value *member = value->getMember(i)->copy(Value::OBJECT_VALUE);
+		Value::deleteValue(&column.values[row], Value::OBJECT_VALUE);
+		column.values[row] = member;
+	}
+	this->data[row] = value->getData();
+}
+
+void StructColumns::remove(size_t row) {
+	if (row >= this->rows) {
+		throw std::runtime_error("Index out of bounds");
+	}
+	for (Column &column : this->columns) {
+		if (column.type == ANY) {
+			Value::deleteValue(&column.values[row], Value::OBJECT_VALUE);
+		}
+		this->eraseCell(column, row);
+	}
+	this->data.erase(this->data.begin() + row);
+	this->rows--;
+}
+
+/**
+ * @brief remove a row from the columns and give its members to a new standalone struct
+ * 
+ * @param row the row to remove
+ * @param range the range of the new struct
+ * @return Struct* the struct which now owns the row members
+ */
+Struct *StructColumns::release(size_t row, const TextRange &range) {
+	if (row >= this->rows) {
+		throw std::runtime_error("Index out of bounds");
+	}
+	Struct *value = new Struct(range, this->definition->getName(), Value::INTERPRETER);
+	for (size_t i = 0; i < this->columns.size(); i++) {
+		Column &column = this->columns[i];
+		if (column.type == ANY) {
+			value->getMember(i) = column.values[row];
+		} else {
+			value->getMember(i) = this->getCell(column, row, range, Value::OBJECT_VALUE);
+		}
+		this->eraseCell(column, row);
+	}
+	value->setData(this->data[row]);
+	this->data.erase(this->data.begin() + row);
+	this->rows--;
+	return value;
+}
+
+/**
+ * @brief copy a row into a new standalone struct, it doesn't change when the list is modified
+ * 
+ * @param row the row to copy
+ * @param range the range of the new struct
+ * @param owner the owner of the new struct
+ * @return Struct* the struct holding a copy of the row members
+ */
+Struct *StructColumns::gather(size_t row, const TextRange &range, Value::ValueOwner owner) const {
+	if (row >= this->rows) {
+		throw std::runtime_error("Index out of bounds");
+	}
+	Struct *value = new Struct(range, this->definition->getName(), owner);
+	for (size_t i = 0; i < this->columns.size(); i++) {
+		value->getMember(i) = this->getCell(this->columns[i], row, range, Value::OBJECT_VALUE);
+	}
+	value->setData(this->data[row]);
+	return value;
+}
+
+/**
+ * @brief compare a row with a row of another list of the same struct, the unboxed members are
+ * compared without creating values
+ */
+bool StructColumns::rowEquals(size_t row, const StructColumns &other, size_t otherRow,
+							  const TextRange &range, const ContextPtr &context) const {
+	if (other.definition != this->definition) {
+		return false;
+	}
+	for (size_t i = 0; i < this->columns.size(); i++) {
+		const Column &column = this->columns[i];
+		const Column &otherColumn = other.columns[i];
+		bool equal = false;
+		switch (column.type) {
+			case INT:
+				equal = column.ints[row] == otherColumn.ints[otherRow];
+				break;
+			case FLOAT:
+				equal = column.floats[row] == otherColumn.floats[otherRow];
+				break;
+			case BOOL:
+				equal = column.bools[row] == otherColumn.bools[otherRow];
+				break;
+			default: {
+				Value *result =
+					column.values[row]->opeq(otherColumn.values[otherRow], range, context);
+				equal = static_cast<const Bool *>(result)->getValue();
+				Value::deleteValue(&result, Value::INTERPRETER);
+				break;
+			}
+		}
+		if (!equal) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void StructColumns::clear() {
+	for (Column &column : this->columns) {
+		for (Value *&value : column.values) {
+			Value::deleteValue(&value, Value::OBJECT_VALUE);
+		}
+		column.ints.clear();
+		column.floats.clear();
+		column.bools.clear();
+		column.values.clear();
+	}
+	this->data.clear();
+	this->rows = 0;
+}
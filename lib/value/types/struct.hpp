@@ -19,7 +19,7 @@ class StructDefinition final {
 		StructDefinition(const StructDefinition &other);
 		StructDefinition(StructDefinition &&other);
 
-		void operator=(StructDefinition &other);
+		void operator=(const StructDefinition &other);
 
 		void addMember(std::string_view name, RPNValueType type);
 		bool hasMember(std::string_view name, RPNValueType *memberType = nullptr) const;
@@ -29,10 +29,14 @@ class StructDefinition final {
 		size_t getMembersCount() const;
 		std::vector<std::string> getMembersOrder() const;
 		RPNValueType getMemberType(std::string_view name) const;
+		RPNValueType getMemberType(size_t index) const;
+		size_t getMemberIndex(std::string_view name) const;
 
 	private:
 		std::string name;
-		std::unordered_map<std::string, RPNValueType> members;
+		// members are stored in slots, the index of a member is its declaration order
+		std::unordered_map<std::string, size_t> memberIndexes;
+		std::vector<RPNValueType> memberTypes;
 		std::vector<std::string> memberOrder;
 
 		friend class Struct;
@@ -40,6 +44,8 @@ class StructDefinition final {
 
 std::ostream &operator<<(std::ostream &stream, const StructDefinition &definition);
 
+class StructColumns;
+
 class Struct : public Value {
 	public:
 		Struct(TextRange range, std::string_view name, ValueOwner owner, bool immutable = false);
@@ -49,6 +55,8 @@ class Struct : public Value {
 		// this is for struct which are used by the interpreter
 		void setMember(const Path *member, Value *value, Value **hold);
 		Value *&getMember(const Path *member);
+		Value *&getMember(size_t index);
+		Value *getMember(size_t index) const;
 
 		// this is for struct which are used by the c++ code
 		void setMember(std::string_view member, Value *value);
@@ -59,7 +67,7 @@ class Struct : public Value {
 		Value *to(ValueType type, ValueOwner owner = INTERPRETER) const;
 		inline Value *copy(ValueOwner owner = INTERPRETER) const;
 		
-		inline std::string getStringValue() const;
+		std::string getStringValue() const override;
 		std::string_view getStructName() const;
 
 		// this is only for struct which are used directly by c++ code
@@ -83,15 +91,79 @@ class Struct : public Value {
 		static void addStructDefinition(StructDefinition &definition);
 		static int  getStructMembersCount(std::string_view structName);
 		static bool structExists(std::string_view structName);
-		static StructDefinition getStructDefinition(std::string_view structName);
-		static Value *&getStruct(const Value *name, const Path *path, const ContextPtr &context);
+		static const StructDefinition &getStructDefinition(std::string_view structName);
+		static Value *getStruct(const Value *name, const Path *path, const ContextPtr &context);
 
 		bool immutable;
 
 	private:
-		StructDefinition *definition;
-		std::shared_ptr<std::unordered_map<std::string, Value*>> members;
+		Struct(TextRange range, const StructDefinition *definition, std::shared_ptr<std::vector<Value*>> members, ValueOwner owner);
+
+		const StructDefinition *definition;
+		std::shared_ptr<std::vector<Value*>> members;
 		std::shared_ptr<void> data;
 
-		static std::unordered_map<std::string, StructDefinition> definitions;
-};
\ No newline at end of file
+		/**
+		 * @brief the definitions are defined inline so the interpreter and the native modules,
+		 * which both link the library statically, are given the same definitions
+		 */
+		static std::unordered_map<Symbol, StructDefinition, SymbolHash> &definitions() {
+			static std::unordered_map<Symbol, StructDefinition, SymbolHash> definitions;
+			return definitions;
+		}
+
+		friend class StructColumns;
+};
+
+/**
+ * @brief Storage of the structs of a list, each member is stored in its own column so reading a
+ * member across the list only walks one array. The int, float and bool members are stored
+ * unboxed and a value is only created when a cell is read, the other members are values owned
+ * by the list. A struct leaving the list is gathered into a standalone struct.
+ */
+class StructColumns final {
+	public:
+		explicit StructColumns(std::string_view structName);
+		StructColumns(const StructColumns &other);
+		~StructColumns();
+
+		const StructDefinition *getDefinition() const;
+		size_t size() const;
+
+		Value *get(size_t row, size_t member, const TextRange &range) const;
+		void set(size_t row, size_t member, Value *value, Value **hold);
+		std::shared_ptr<void> getData(size_t row) const;
+		void setData(size_t row, const std::shared_ptr<void> &data);
+
+		void insert(size_t row, const Struct *value);
+		void append(const StructColumns &other, size_t row);
+		void set(size_t row, const Struct *value);
+		void remove(size_t row);
+		Struct *release(size_t row, const TextRange &range);
+		Struct *gather(size_t row, const TextRange &range, Value::ValueOwner owner) const;
+		bool rowEquals(size_t row, const StructColumns &other, size_t otherRow,
+					   const TextRange &range, const ContextPtr &context) const;
+		void clear();
+
+	private:
+		// only the cells of the member type are used, ANY is used for the boxed members
+		struct Column {
+			ValueType type = ANY;
+			std::vector<int64_t> ints;
+			std::vector<float> floats;
+			std::vector<uint8_t> bools;
+			std::vector<Value *> values;
+		};
+
+		void checkDefinition(const Struct *value) const;
+		void insertCell(Column &column, size_t row, const Value *value);
+		void storeCell(Column &column, size_t row, const Value *value);
+		Value *getCell(const Column &column, size_t row, const TextRange &range,
+					   Value::ValueOwner owner) const;
+		void eraseCell(Column &column, size_t row);
+
+		const StructDefinition *definition;
+		std::vector<Column> columns;
+		std::vector<std::shared_ptr<void>> data;
+		size_t rows;
+};
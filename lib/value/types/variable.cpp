@@ -2,13 +2,18 @@
 
 Variable::Variable(std::string_view value, TextRange range) :
 	Value(VARIABLE, range, Value::CONTEXT_VARIABLE),
-	value(value) {}
+	value(value),
+	symbol(value) {}
 
 
 inline std::string Variable::getStringValue() const {
 	return value;
 }
 
+Symbol Variable::getSymbol() const {
+	return this->symbol;
+}
+
 Value *Variable::to(ValueType type, ValueOwner owner) const {
 	throw std::runtime_error("Invalid value type");
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include "textutilities/symbol.hpp"
 #include "textutilities/textrange.hpp"
 #include "value/value.hpp"
 
@@ -12,6 +13,7 @@ class Variable : public Value {
 		Variable(std::string_view value, TextRange range);
 
 		inline std::string getStringValue() const;
+		Symbol getSymbol() const;
 
 		bool isNumber() const { return false; };
 
@@ -34,4 +36,5 @@ class Variable : public Value {
 
 	private:
 		std::string value;
+		Symbol symbol;
 };
\ No newline at end of file
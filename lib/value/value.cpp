@@ -1,7 +1,11 @@
 #include "value/value.hpp"
+#include "counters/counters.hpp"
+#include "runtimestats/runtimestats.hpp"
+#include "value/types/list.hpp"
 
 Value::Value(ValueType type, const TextRange range, ValueOwner owner, const TextRange variableRange)
 	: range(range), type(type), owner(owner) {
+	RPN_COUNT_ALLOCATION(type);
 	if (type == ANY) {
 		throw std::runtime_error("ANY type is not allowed in value type");
 	}
@@ -10,6 +14,17 @@ Value::Value(ValueType type, const TextRange range, ValueOwner owner, const Text
 	} else {
 		this->variableRange = variableRange;
 	}
+	RuntimeStats::valueCreated(type);
+	if (Value::onCreate != nullptr && owner != CONSTANT) {
+		Value::onCreate(this);
+	}
+}
+
+Value::~Value() {
+	RuntimeStats::valueDestroyed(this->type);
+	if (Value::onDestroy != nullptr) {
+		Value::onDestroy(this);
+	}
 }
 
 ValueType Value::getType() const {
@@ -17,6 +32,7 @@ ValueType Value::getType() const {
 }
 
 void Value::setType(ValueType type) {
+	RuntimeStats::valueRetyped(this->type, type);
 	this->type = type;
 }
 
@@ -35,12 +51,22 @@ TextRange Value::getVariableRange() const {
 	return this->variableRange;
 }
 
+/**
+ * @brief set the range of the variable or of the call giving the value, the shared CONSTANT
+ * values are used by several tokens at the same time so they keep no range
+ *
+ * @param range the range of the variable
+ */
 void Value::setVariableRange(const TextRange &range) {
-	this->variableRange = range;
+	if (this->owner != CONSTANT) {
+		this->variableRange = range;
+	}
 }
 
 void Value::setVariableRange(const TextRange &&range) {
-	this->variableRange = range;
+	if (this->owner != CONSTANT) {
+		this->variableRange = range;
+	}
 }
 
 void Value::concatValueRange(const Value *other) {
@@ -104,6 +130,12 @@ Value *Value::applyOperator(const Value *other, const Token *operatorToken,
 		case OperatorToken::OP_LE:
 			return this->ople(other, range, context);
 			break;
+		case OperatorToken::OP_VADD:
+		case OperatorToken::OP_VSUB:
+		case OperatorToken::OP_VMUL:
+		case OperatorToken::OP_VDIV:
+			return List::vectorOperation(this, other, op, range);
+			break;
 	}
 
 	throw std::runtime_error("This operator doesn't exist");
@@ -114,6 +146,9 @@ Value::ValueOwner Value::getOwner() const {
 }
 
 void Value::setOwner(ValueOwner owner, bool overwrite) {
+	if (this->owner == CONSTANT) {
+		return;
+	}
 	if (overwrite || owner > this->owner) {
 		this->owner = owner;
 	}
@@ -124,8 +159,11 @@ void Value::setOwner(ValueOwner owner, bool overwrite) {
  *
  * @param val the value to delete
  */
+void (*Value::onCreate)(const Value *value) = nullptr;
+void (*Value::onDestroy)(const Value *value) = nullptr;
+
 void Value::deleteValue(Value **val, ValueOwner deleter) {
-	if ((*val) == nullptr || (*val)->owner != deleter)
+	if ((*val) == nullptr || (*val)->owner != deleter || deleter == CONSTANT)
 		return;
 	delete (*val);
 	(*val) = nullptr;
@@ -23,11 +23,13 @@ class Value {
 		OBJECT_VALUE = 3,
 		VALUE_TOKEN = 4,
 		MODULE = 5,
-		EMPTY_VALUE = 6
+		EMPTY_VALUE = 6,
+		// process wide shared values (small ints, booleans, none), they are never deleted
+		CONSTANT = 7
 	};
 	Value(ValueType type, const TextRange range, ValueOwner owner,
 		  const TextRange variableRange = TextRange());
-	virtual ~Value() = default;
+	virtual ~Value();
 
 	virtual bool isNumber() const = 0;
 
@@ -82,6 +84,11 @@ class Value {
 
 	static void deleteValue(Value **val, ValueOwner deleter);
 
+	// called when a value which isn't a constant is created and destroyed, set by the allocation
+	// profiler. They are exported to the native modules so their values are seen too
+	static void (*onCreate)(const Value *value);
+	static void (*onDestroy)(const Value *value);
+
   protected:
 	TextRange range, variableRange;
 	ValueType type;
@@ -22,8 +22,16 @@ std::string stringType(const ValueType &type) {
 			return "none";
 		case VARIABLE:
 			return "variable";
+		case BUILTIN_VARIABLE:
+			return "builtin variable";
 		case PATH:
 			return "path";
+		case BUILTIN_PATH:
+			return "builtin path";
+		case STRUCT_ACCESS:
+			return "struct access";
+		case LIST_ELEMENT:
+			return "list element";
 		case LIST:
 			return "list";
 		case ANY:
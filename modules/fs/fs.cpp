@@ -1,6 +1,6 @@
 #include "fs.hpp"
 
-std::variant<std::ios_base::openmode, ExpressionResult>
+static std::variant<std::ios_base::openmode, ExpressionResult>
 fromChar(char c, const TextRange &range, ContextPtr context, std::ios_base::openmode mode) {
 	switch (c) {
 		case 'r':
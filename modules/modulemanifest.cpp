@@ -0,0 +1,28 @@
+#include <iostream>
+
+#include "cppmodule/cppmodule.hpp"
+
+/**
+ * @brief write the manifest of a builtin module after it is built, the interpreter imports the
+ * module from it without opening the library until one of its functions is called
+ *
+ * usage: RPNmoduleManifest <modules folder> <module name>
+ */
+int main(int argc, char **argv) {
+	if (argc != 3) {
+		std::cerr << "Usage: RPNmoduleManifest <modules folder> <module name>" << std::endl;
+		return 1;
+	}
+	CppModule::setBuiltinModulesPath(argv[1]);
+	CppModule module(argv[2]);
+	ExpressionResult result = module.open(TextRange());
+	if (result.error()) {
+		result.display();
+		return 1;
+	}
+	if (!module.writeManifest()) {
+		std::cout << "Module " << argv[2] << " has no manifest, it is opened when it is imported"
+				  << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,100 @@
+#include "runtime.hpp"
+
+ExpressionResult loader(CppModule *module) {
+	module->addFunction(
+		"liveValues", {{"type", STRING}}, INT,
+		[](RPNFunctionArgsValue args, const TextRange &range,
+		   ContextPtr context) -> RPNFunctionResult {
+			const std::string type = args[0]->getStringValue();
+			for (int i = 0; i <= NONE; i++) {
+				if (i != ANY && stringType(static_cast<ValueType>(i)) == type) {
+					return new Int(RuntimeStats::get().getLiveValues(static_cast<ValueType>(i)),
+							   range, Value::INTERPRETER);
+				}
+			}
+			return ExpressionResult("Unknown type " + type, args[0]->getRange(), context);
+		});
+
+	module->addFunction("allocations", {}, INT,
+						[](RPNFunctionArgsValue args, const TextRange &range,
+						   ContextPtr context) -> RPNFunctionResult {
+							return new Int(
+								static_cast<int64_t>(RuntimeStats::get().getCreatedValues()), range,
+								Value::INTERPRETER);
+						});
+
+	module->addFunction("heapInUse", {}, INT,
+						[](RPNFunctionArgsValue args, const TextRange &range,
+						   ContextPtr context) -> RPNFunctionResult {
+							// the live heap, the bytes freed since the start are not counted
+							const struct mallinfo2 info = mallinfo2();
+							return new Int(static_cast<int64_t>(info.uordblks + info.hblkhd), range,
+										   Value::INTERPRETER);
+						});
+
+	module->addFunction(
+		"calls", {{"function", STRING}}, INT,
+		[](RPNFunctionArgsValue args, const TextRange &range,
+		   ContextPtr context) -> RPNFunctionResult {
+			uint64_t calls = 0;
+			if (!RuntimeStats::getFunctionCalls(args[0]->getStringValue(), calls)) {
+				return ExpressionResult("Unknown function " + args[0]->getStringValue(),
+										args[0]->getRange(), context);
+			}
+			return new Int(static_cast<int64_t>(calls), range, Value::INTERPRETER);
+		});
+
+	module->addFunction("cacheHits", {}, INT,
+						[](RPNFunctionArgsValue args, const TextRange &range,
+						   ContextPtr context) -> RPNFunctionResult {
+							return new Int(static_cast<int64_t>(RuntimeStats::get().cacheHits),
+										   range, Value::INTERPRETER);
+						});
+
+	module->addFunction("cacheMisses", {}, INT,
+						[](RPNFunctionArgsValue args, const TextRange &range,
+						   ContextPtr context) -> RPNFunctionResult {
+							return new Int(static_cast<int64_t>(RuntimeStats::get().cacheMisses),
+										   range, Value::INTERPRETER);
+						});
+
+	module->addFunction(
+		"cacheHitRate", {}, FLOAT,
+		[](RPNFunctionArgsValue args, const TextRange &range,
+		   ContextPtr context) -> RPNFunctionResult {
+			const auto hits = static_cast<float>(RuntimeStats::get().cacheHits);
+			const float lookups = hits + static_cast<float>(RuntimeStats::get().cacheMisses);
+			return new Float(lookups == 0 ? 0.0F : hits / lookups, range, Value::INTERPRETER);
+		});
+
+	module->addFunction("rss", {}, INT,
+						[](RPNFunctionArgsValue args, const TextRange &range,
+						   ContextPtr context) -> RPNFunctionResult {
+							// the second field is the number of resident pages
+							int64_t pages = 0;
+							std::ifstream("/proc/self/statm") >> pages >> pages;
+							return new Int(pages * sysconf(_SC_PAGESIZE), range,
+										   Value::INTERPRETER);
+						});
+
+	module->addFunction("peakRss", {}, INT,
+						[](RPNFunctionArgsValue args, const TextRange &range,
+						   ContextPtr context) -> RPNFunctionResult {
+							rusage usage{};
+							getrusage(RUSAGE_SELF, &usage);
+							return new Int(static_cast<int64_t>(usage.ru_maxrss) * 1024, range,
+										   Value::INTERPRETER);
+						});
+
+	module->addFunction(
+		"monotonic", {}, INT,
+		[](RPNFunctionArgsValue args, const TextRange &range,
+		   ContextPtr context) -> RPNFunctionResult {
+			using namespace std::chrono;
+			return new Int(
+				duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count(), range,
+				Value::INTERPRETER);
+		});
+
+	return ExpressionResult();
+};
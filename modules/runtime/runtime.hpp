@@ -0,0 +1,18 @@
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <malloc.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "cppmodule/cppmodule.hpp"
+#include "expressionresult/expressionresult.hpp"
+#include "runtimestats/runtimestats.hpp"
+#include "value/types/numbers/float.hpp"
+#include "value/types/numbers/int.hpp"
+#include "value/value.hpp"
+
+ExpressionResult loader(CppModule *module);
+
+ModuleAPI moduleAPI{"Runtime", "RPNlang runtime statistics module", "1.0", "Robotechnic", loader};
@@ -1,6 +1,6 @@
 #include "terminal.hpp"
 
-struct termios holdTermios;
+static struct termios holdTermios;
 
 ExpressionResult loader(CppModule *module) {
 	ExpressionResult result;
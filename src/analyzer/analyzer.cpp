@@ -1,8 +1,19 @@
 #include "analyzer/analyzer.hpp"
 
+#include <algorithm>
+
+/**
+ * @brief an analyzer for a function body, it reads the variables and the functions of the entry
+ * point from its parent which is not modified while it runs
+ *
+ * @param parent the analyzer of the entry point
+ */
+Analyzer::Analyzer(const Analyzer *parent) : context(parent->context), parent(parent) {}
+
 Analyzer::Analyzer(ContextPtr context) : context(context) {
 	// add variables of the current context
-	for (const auto &[name, variable] : context->getSymbols()) {
+	for (const auto &[symbol, variable] : context->getSymbols()) {
+		std::string const &name = symbol.name();
 		this->variables[name] = {
 			variable->getType(), variable->getRange(), false, 0, 0, false, false};
 		if (variable->getType() == FUNCTION) {
@@ -11,7 +22,18 @@ Analyzer::Analyzer(ContextPtr context) : context(context) {
 	}
 }
 
+/**
+ * @brief analyze blocks of code, an entry point can be analyzed after other ones with the same
+ * analyzer, it knows the variables and the functions declared by the previous ones
+ *
+ * @param blocks the blocks to analyze
+ * @param entryPoint if the blocks are the top level code, the function bodies are analyzed at the
+ * end
+ */
 void Analyzer::analyze(BlockQueue &blocks, bool entryPoint) {
+	if (entryPoint) {
+		this->stack = {};
+	}
 	for (auto it = blocks.begin(); it != blocks.end() && !this->hasErrors(); it++) {
 		if ((*it)->getType() == blockType::LINE_BLOCK) {
 			this->analyze(dynamic_cast<Line *>(*it));
@@ -40,6 +62,20 @@ void Analyzer::analyze(BlockQueue &blocks, bool entryPoint) {
 	}
 }
 
+/**
+ * @brief the variables declared conditionally by the last entry point which were assigned when it
+ * was interpreted can be used unconditionally by the next entry points
+ *
+ * @param symbols the symbols assigned by the interpreter
+ */
+void Analyzer::confirmDeclarations(const std::vector<Symbol> &symbols) {
+	for (Symbol const symbol : symbols) {
+		if (auto it = this->variables.find(symbol.name()); it != this->variables.end()) {
+			it->second.conditionalLevel = 0;
+		}
+	}
+}
+
 void Analyzer::analyze(CodeBlock *block) {
 	this->conditionalLevel++;
 	if (this->nextConditionalLevel.size() <= this->conditionalLevel) {
@@ -116,7 +152,7 @@ void Analyzer::analyze(Line *line) {
 				this->analyzeFunctionCall(token);
 				break;
 			case TokenType::TOKEN_TYPE_LITERAL:
-				if (builtins::builtinFunctions.contains(token->getStringValue())) {
+				if (builtins::find(token->getStringValue()) != nullptr) {
 					dynamic_cast<ValueToken *>(token)->getValue()->setType(BUILTIN_VARIABLE);
 				}
 				this->stack.emplace(token->getStringValue(), token->getRange(), true, 0, 0, false);
@@ -161,9 +197,11 @@ std::optional<AnalyzerValueType> Analyzer::getVariable(const std::string &name)
 		variablesMap = &this->functionVariables;
 	} else if (this->variables.contains(name)) {
 		variablesMap = &this->variables;
-	} else if (builtins::builtinFunctions.contains(name)) {
-		BuiltinRPNFunction const &builtinFunction = builtins::builtinFunctions.at(name);
-		this->functions[name] = builtinFunction.getSignature();
+	} else if (this->parent != nullptr && this->parent->variables.contains(name)) {
+		return {this->parent->variables.at(name)};
+	} else if (const BuiltinRPNFunction *builtinFunction = builtins::find(name);
+			   builtinFunction != nullptr) {
+		this->functions[name] = builtinFunction->getSignature();
 		AnalyzerValueType type = {name, TextRange(), false, 0, 0, false, false, true};
 		this->variables[name] = type;
 		return type;
@@ -207,7 +245,7 @@ AnalyzerSymbolTable *Analyzer::getVariables() {
 }
 
 void Analyzer::analyze(FunctionBlock *functionBlock) {
-	if (functions.contains(functionBlock->getName())) {
+	if (this->findFunction(functionBlock->getName()) != nullptr) {
 		this->error =
 			ExpressionResult("Function " + functionBlock->getName() + " is already defined",
 							 functionBlock->lastRange(), this->context);
@@ -221,7 +259,7 @@ void Analyzer::analyze(FunctionBlock *functionBlock) {
 }
 
 void Analyzer::analyze(const FunctionSignatureLine *functionSignatureLine) {
-	if (functions.contains(functionSignatureLine->getName())) {
+	if (this->findFunction(functionSignatureLine->getName()) != nullptr) {
 		this->error =
 			ExpressionResult("Function " + functionSignatureLine->getName() + " is already defined",
 							 functionSignatureLine->lastRange(), this->context);
@@ -231,39 +269,134 @@ void Analyzer::analyze(const FunctionSignatureLine *functionSignatureLine) {
 	functions[functionSignatureLine->getName()] = functionSignatureLine->getSignature();
 }
 
+/**
+ * @brief analyze the bodies of the functions declared by the entry point. The signatures are all
+ * known at this point so the bodies are independent, each one is analyzed with its own state on
+ * the thread pool. The diagnostic of the first body in the source is kept
+ */
 void Analyzer::analyzeFunctionsBody() {
+	std::vector<FunctionBlock *> bodies(this->functionBlocks.size());
+	for (auto it = bodies.rbegin(); it != bodies.rend(); it++) {
+		*it = this->functionBlocks.top();
+		this->functionBlocks.pop();
+	}
+
+	std::vector<ExpressionResult> errors(bodies.size());
+	// an import loads the module while it is analyzed so these bodies stay on this thread
+	std::vector<size_t> parallelBodies;
+	for (size_t i = 0; i < bodies.size(); i++) {
+		if (Analyzer::containsImport(bodies[i]->getBlocks())) {
+			errors[i] = Analyzer(this).analyzeFunctionBody(bodies[i]);
+		} else {
+			parallelBodies.push_back(i);
+		}
+	}
+
+	constexpr size_t batchSize = 32;
+	std::vector<std::future<void>> batches;
+	for (size_t start = 0; start < parallelBodies.size(); start += batchSize) {
+		const size_t end = std::min(start + batchSize, parallelBodies.size());
+		auto batch = [this, &bodies, &errors, &parallelBodies, start, end]() {
+			for (size_t i = start; i < end; i++) {
+				const size_t body = parallelBodies[i];
+				errors[body] = Analyzer(this).analyzeFunctionBody(bodies[body]);
+			}
+		};
+		if (parallelBodies.size() <= batchSize) {
+			batch();
+		} else {
+			batches.push_back(ThreadPool::shared().submit(batch));
+		}
+	}
+	for (std::future<void> &batch : batches) {
+		batch.get();
+	}
+
+	auto firstError = std::ranges::find_if(errors, &ExpressionResult::error);
+	if (firstError != errors.end()) {
+		this->error = *firstError;
+	}
+}
+
+/**
+ * @brief analyze a function body and the functions declared inside it
+ *
+ * @param function the function to analyze
+ * @return ExpressionResult the first error found
+ */
+ExpressionResult Analyzer::analyzeFunctionBody(FunctionBlock *function) {
 	this->inFunctionBlock = true;
+	this->functionBlocks.push(function);
 	while (!this->functionBlocks.empty() && !this->hasErrors()) {
-		RPNFunctionArgs const args = this->functionBlocks.top()->getArgs();
+		FunctionBlock *current = this->functionBlocks.top();
+		this->functionBlocks.pop();
+		RPNFunctionArgs const args = current->getArgs();
 		for (const auto &[name, valueType] : args) {
 			if (valueType.index() == 0 && std::get<std::string>(valueType.getType())[0] == '$') {
 				const std::string functionName =
 					std::get<std::string>(valueType.getType()).substr(1);
-				if (!this->functions.contains(functionName)) {
-					this->error =
-						ExpressionResult("Function signature " + functionName + " is not defined",
-										 this->functionBlocks.top()->lastRange(), this->context);
-					return;
+				if (this->findFunction(functionName) == nullptr) {
+					return {"Function signature " + functionName + " is not defined",
+							current->lastRange(), this->context};
 				}
-				this->functionVariables[name] = {functionName,
-												 this->functionBlocks.top()->lastRange(),
-												 false,
-												 0,
-												 0,
-												 false,
-												 false,
-												 true};
+				this->functionVariables[name] = {
+					functionName, current->lastRange(), false, 0, 0, false, false, true};
 			} else {
-				this->functionVariables[name] = {valueType, this->functionBlocks.top()->lastRange(),
-												 true, 0};
+				this->functionVariables[name] = {valueType, current->lastRange(), true, 0};
 			}
 		}
-		this->currentFunctionReturnType = this->functionBlocks.top()->getReturnType();
-		this->analyze(this->functionBlocks.top()->getBlocks());
-		this->functionBlocks.pop();
+		this->currentFunctionReturnType = current->getReturnType();
+		this->analyze(current->getBlocks());
 		this->functionVariables.clear();
 	}
 	this->inFunctionBlock = false;
+	return this->error;
+}
+
+/**
+ * @brief check if some blocks import a module
+ *
+ * @param blocks the blocks to check
+ * @return bool if an import keyword is found
+ */
+bool Analyzer::containsImport(BlockQueue &blocks) {
+	for (BaseBlock *block : blocks) {
+		if (block->getType() == blockType::LINE_BLOCK) {
+			for (Token *token : *dynamic_cast<Line *>(block)) {
+				if (token->getType() != TokenType::TOKEN_TYPE_KEYWORD) {
+					continue;
+				}
+				const KeywordEnum keyword = dynamic_cast<KeywordToken *>(token)->getKeyword();
+				if (keyword == KEYWORD_IMPORT || keyword == KEYWORD_IMPORTAS) {
+					return true;
+				}
+			}
+		} else if (block->getType() == blockType::CODE_BLOCK) {
+			for (auto *codeBlock = dynamic_cast<CodeBlock *>(block); codeBlock != nullptr;
+				 codeBlock = codeBlock->getNext()) {
+				if (Analyzer::containsImport(codeBlock->getBlocks())) {
+					return true;
+				}
+			}
+		} else if (block->getType() == blockType::FUNCTION_BLOCK &&
+				   Analyzer::containsImport(dynamic_cast<FunctionBlock *>(block)->getBlocks())) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief find the signature of a function declared in this analyzer or in its parent
+ *
+ * @param name the name of the function
+ * @return const FunctionSignature* the signature or nullptr if the function is unknown
+ */
+const FunctionSignature *Analyzer::findFunction(std::string_view name) const {
+	if (auto it = this->functions.find(name); it != this->functions.end()) {
+		return &it->second;
+	}
+	return this->parent != nullptr ? this->parent->findFunction(name) : nullptr;
 }
 
 void Analyzer::analyzeOperator(const OperatorToken *token) {
@@ -294,27 +427,59 @@ void Analyzer::analyzeOperator(const OperatorToken *token) {
 		return;
 	}
 	stack.pop();
+	if (token->isVectorOperator()) {
+		std::optional<RPNValueType> const vectorType =
+			Analyzer::getVectorOperatorType(left.type, right.type);
+		if (vectorType.has_value()) {
+			stack.emplace(vectorType.value(),
+						  TextRange::merge(left.range, right.range).merge(token->getRange()),
+						  false);
+			return;
+		}
+		this->error =
+			ExpressionResult("Can't apply operator " + token->getStringValue() + " to types " +
+								 left.type.name() + " and " + right.type.name(),
+							 token->getRange(), this->context);
+		return;
+	}
 	std::optional<ValueType> resultType = Analyzer::getOperatorType(
 		std::get<ValueType>(left.type.getType()), std::get<ValueType>(right.type.getType()), token);
 	if (resultType.has_value()) {
+		// comparing two lists gives a single bool like at runtime, not a list of the operand type
+		if (Analyzer::isComparisonOperator(token->getOperatorType())) {
+			stack.emplace(resultType.value(),
+						  TextRange::merge(left.range, right.range).merge(token->getRange()),
+						  false);
+			return;
+		}
 		if (std::get<ValueType>(left.type.getType()) == LIST &&
 			std::get<ValueType>(right.type.getType()) == LIST) {
-			std::optional<ValueType> listType =
-				Analyzer::getOperatorType(std::get<ValueType>(left.type.getListType()),
-										  std::get<ValueType>(right.type.getListType()), token);
-			if (listType.has_value()) {
-				stack.emplace(RPNValueType{LIST, listType.value()},
-							  TextRange::merge(left.range, right.range).merge(token->getRange()),
-							  false);
-				return;
+			// lists of structs can only be combined with lists of the same struct
+			if (left.type.getListType().index() == 0 || right.type.getListType().index() == 0) {
+				if (left.type.getListType() == right.type.getListType()) {
+					stack.emplace(left.type,
+								  TextRange::merge(left.range, right.range).merge(token->getRange()),
+								  false);
+					return;
+				}
+			} else {
+				std::optional<ValueType> listType =
+					Analyzer::getOperatorType(std::get<ValueType>(left.type.getListType()),
+											  std::get<ValueType>(right.type.getListType()), token);
+				if (listType.has_value()) {
+					stack.emplace(
+						RPNValueType{LIST, listType.value()},
+						TextRange::merge(left.range, right.range).merge(token->getRange()), false);
+					return;
+				}
 			}
 		} else if (std::get<ValueType>(left.type.getType()) == LIST) {
-			stack.emplace(RPNValueType{LIST, std::get<ValueType>(left.type.getListType())},
+			stack.emplace(left.type,
 						  TextRange::merge(left.range, right.range).merge(token->getRange()),
 						  false);
 			return;
 		} else if (std::get<ValueType>(right.type.getType()) == LIST) {
-			stack.emplace(RPNValueType{LIST, std::get<ValueType>(right.type.getListType())},
+			stack.emplace(right.type,
 						  TextRange::merge(left.range, right.range).merge(token->getRange()),
 						  false);
 			return;
@@ -362,6 +527,7 @@ void Analyzer::analyzeFunctionCall(FunctionSignature function, Token *token) {
 	TextRange range = token->getRange();
 	RPNValueType type;
 	AnalyzerValueType top;
+	std::vector<RPNValueType> argumentTypes(function.args.size());
 	for (int i = function.args.size() - 1; i >= 0; i--) {
 		top = this->topVariable();
 		type = top.type;
@@ -385,10 +551,11 @@ void Analyzer::analyzeFunctionCall(FunctionSignature function, Token *token) {
 										   stack.top().range, this->context);
 			return;
 		}
+		argumentTypes[i] = type;
 		range.merge(stack.top().range);
 		stack.pop();
 	}
-	this->stack.emplace(function.returnType, range, false);
+	this->stack.emplace(function.resolveReturnType(argumentTypes), range, false);
 }
 
 std::optional<FunctionSignature> Analyzer::checkBuiltinFunction(Token *token) {
@@ -403,8 +570,7 @@ std::optional<FunctionSignature> Analyzer::checkBuiltinFunction(Token *token) {
 		const Value *path = dynamic_cast<const ValueToken *>(token)->getValue();
 		function = dynamic_cast<const Function *>(Module::getModuleValue(path))->getValue();
 		builtin = path->getType() == BUILTIN_PATH;
-	} else if (builtins::builtinFunctions.contains(name)) {
-		function = &builtins::builtinFunctions.at(name);
+	} else if ((function = builtins::find(name)) != nullptr) {
 		builtin = true;
 	}
 	if (function == nullptr) {
@@ -420,8 +586,8 @@ std::optional<FunctionSignature> Analyzer::checkBuiltinFunction(Token *token) {
 
 void Analyzer::analyzeFunctionCall(Token *token) {
 	std::string const name = token->getStringValue();
-	if (functions.contains(name)) {
-		this->analyzeFunctionCall(functions[name], token);
+	if (const FunctionSignature *signature = this->findFunction(name); signature != nullptr) {
+		this->analyzeFunctionCall(*signature, token);
 		return;
 	}
 	const auto variable = this->getVariable(name);
@@ -433,8 +599,9 @@ void Analyzer::analyzeFunctionCall(Token *token) {
 			return;
 		}
 		const std::string functionName = std::get<std::string>(variableValue.type.getType());
-		if (functions.contains(functionName)) {
-			this->analyzeFunctionCall(functions[functionName], token);
+		if (const FunctionSignature *signature = this->findFunction(functionName);
+			signature != nullptr) {
+			this->analyzeFunctionCall(*signature, token);
 			return;
 		}
 	}
@@ -455,9 +622,10 @@ bool Analyzer::checkFunctionSignature(const std::string_view &signatureName,
 	if (signatureName == functionnName) {
 		return true;
 	}
-	const FunctionSignature &expectedSignature = this->functions.at(std::string(signatureName));
-	const FunctionSignature &actualSignature = this->functions.at(std::string(functionnName));
-	if (expectedSignature.returnType.getType() != actualSignature.returnType.getType()) {
+	const FunctionSignature &expectedSignature = *this->findFunction(signatureName);
+	const FunctionSignature &actualSignature = *this->findFunction(functionnName);
+	if (expectedSignature.returnType.getType() != actualSignature.returnType.getType() ||
+		expectedSignature.returnRule != actualSignature.returnRule) {
 		return false;
 	}
 	if (expectedSignature.args.size() != actualSignature.args.size()) {
@@ -755,7 +923,7 @@ void Analyzer::analyzePath(Token *path, bool addToStack) {
 	Value const *variable = Module::getModuleValue(p);
 	if (variable->getType() != FUNCTION) {
 		this->stack.emplace(variable->getType(), p->getRange(), false, 0, 0, false);
-	} else if (!this->functions.contains(p->getStringValue())) {
+	} else if (this->findFunction(p->getStringValue()) == nullptr) {
 	}
 }
 
@@ -833,14 +1001,14 @@ void Analyzer::checkKeywordLine(const KeywordToken *token, bool restaureStack, b
 	}
 }
 
-void Analyzer::analyzeStructAccess(const Token *token) {
+void Analyzer::analyzeStructAccess(Token *token) {
 	if (this->stack.empty()) {
 		this->error =
 			ExpressionResult("Struct access require a struct", token->getRange(), this->context);
 		return;
 	}
-	std::vector<std::string> path =
-		dynamic_cast<const Path *>(dynamic_cast<const ValueToken *>(token)->getValue())->getPath();
+	Path *pathValue = dynamic_cast<Path *>(dynamic_cast<ValueToken *>(token)->getValue());
+	std::vector<std::string> path = pathValue->getPath();
 	std::string const variableName = this->stack.top().name();
 	this->topVariable();
 	if (this->hasErrors()) {
@@ -858,25 +1026,30 @@ void Analyzer::analyzeStructAccess(const Token *token) {
 									   token->getRange(), this->context);
 		return;
 	}
-	StructDefinition const definition =
-		Struct::getStructDefinition(std::get<std::string>(structType.type.getType()));
+	const StructDefinition *definition =
+		&Struct::getStructDefinition(std::get<std::string>(structType.type.getType()));
 	RPNValueType type;
+	// resolve each member to its slot so the interpreter doesn't have to look names up
+	std::vector<size_t> offsets;
 	for (size_t i = 0; i < path.size(); i++) {
-		if (!definition.hasMember(path.at(i))) {
-			this->error = ExpressionResult("Struct " + structType.name() +
+		if (!definition->hasMember(path.at(i), &type)) {
+			this->error = ExpressionResult("Struct " + definition->getName() +
 											   " does not have a member named " + path.at(i),
 										   token->getRange(), this->context);
 			return;
 		}
-		type = definition.getMemberType(path.at(i));
-		if (i < path.size() - 1 &&
-			(type.index() != 0 || std::get<ValueType>(type.getType()) != STRUCT)) {
-			this->error = ExpressionResult("Member " + path.at(i) + " of struct " +
-											   structType.name() + " is not a struct",
-										   token->getRange(), this->context);
-			return;
+		offsets.push_back(definition->getMemberIndex(path.at(i)));
+		if (i < path.size() - 1) {
+			if (type.index() != 0) {
+				this->error = ExpressionResult("Member " + path.at(i) + " of struct " +
+												   definition->getName() + " is not a struct",
+											   token->getRange(), this->context);
+				return;
+			}
+			definition = &Struct::getStructDefinition(std::get<std::string>(type.getType()));
 		}
 	}
+	pathValue->setOffsets(offsets);
 	this->stack.emplace(type, token->getRange(), false, 0, 0, true, false);
 }
 
@@ -973,6 +1146,45 @@ std::optional<ValueType> Analyzer::getOperatorType(ValueType left, ValueType rig
 	return std::nullopt;
 }
 
+/**
+ * @brief Get the type of the result of an element-wise operator (.+ .- .* ./)
+ * At least one operand must be a list and every element must be a number, the result is a list
+ * of int if both sides only contain integers or booleans and a list of float otherwise
+ *
+ * @param left the left operand type
+ * @param right the right operand type
+ * @return std::optional<RPNValueType> the result type or nothing if the operator can't be applied
+ */
+std::optional<RPNValueType> Analyzer::getVectorOperatorType(const RPNValueType &left,
+															const RPNValueType &right) {
+	ValueType const leftType = std::get<ValueType>(left.getType());
+	ValueType const rightType = std::get<ValueType>(right.getType());
+	if (leftType != LIST && rightType != LIST && leftType != ANY && rightType != ANY) {
+		return std::nullopt;
+	}
+	if ((leftType == LIST && left.getListType().index() == 0) ||
+		(rightType == LIST && right.getListType().index() == 0)) {
+		return std::nullopt;
+	}
+	ValueType const leftElement =
+		leftType == LIST ? std::get<ValueType>(left.getListType()) : leftType;
+	ValueType const rightElement =
+		rightType == LIST ? std::get<ValueType>(right.getListType()) : rightType;
+	auto isNumeric = [](ValueType type) {
+		return type == INT || type == FLOAT || type == BOOL || type == ANY;
+	};
+	if (!isNumeric(leftElement) || !isNumeric(rightElement)) {
+		return std::nullopt;
+	}
+	if (leftElement == ANY || rightElement == ANY) {
+		return RPNValueType{LIST, ANY};
+	}
+	if (leftElement == FLOAT || rightElement == FLOAT) {
+		return RPNValueType{LIST, FLOAT};
+	}
+	return RPNValueType{LIST, INT};
+}
+
 std::ostream &operator<<(std::ostream &stream, const AnalyzerValueType &valueType) {
 	if (valueType.type.index() == 0) {
 		stream << (valueType.isVariable
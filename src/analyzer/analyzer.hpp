@@ -8,6 +8,7 @@
 // NOLINTBEGIN
 // clang-format off
 #include "expressionresult/expressionresult.hpp"
+#include "textutilities/stringhash.hpp"
 #include "value/valuetypes.hpp"
 #include "value/types/numbers/int.hpp"
 #include "value/types/struct.hpp"
@@ -24,6 +25,7 @@
 #include "codeblocks/functionsignatureline.hpp"
 #include "codeblocks/blockqueue.hpp"
 #include "rpnfunctions/functionsignature.hpp"
+#include "threadpool/threadpool.hpp"
 // clang-format on
 // NOLINTEND
 
@@ -58,13 +60,17 @@ class Analyzer final {
 	explicit Analyzer(ContextPtr context);
 
 	void analyze(BlockQueue &blocks, bool entryPoint = false);
+	void confirmDeclarations(const std::vector<Symbol> &symbols);
 
 	bool hasErrors() const;
 	ExpressionResult analyzeErrors() const;
 
   private:
+	explicit Analyzer(const Analyzer *parent);
+
 	ExpressionResult error;
 	ContextPtr context;
+	const Analyzer *parent = nullptr;
 	unsigned int conditionalLevel = 0;
 	bool inFunctionBlock = false;
 	RPNValueType currentFunctionReturnType;
@@ -85,6 +91,8 @@ class Analyzer final {
 	void analyze(FunctionBlock *functionBlock);
 	void analyze(const FunctionSignatureLine *functionSignatureLine);
 	void analyzeFunctionsBody();
+	ExpressionResult analyzeFunctionBody(FunctionBlock *function);
+	const FunctionSignature *findFunction(std::string_view name) const;
 	void checkRemainingCount();
 	void analyzeOperator(const OperatorToken *token);
 	void analyzeFString(const FStringToken *token);
@@ -100,16 +108,19 @@ class Analyzer final {
 	void analyzeImportAs(const KeywordToken *token);
 	void analyzeReturn(const KeywordToken *token);
 	void analyzePath(Token *path, bool addToStack = true);
-	void analyzeStructAccess(const Token *token);
+	void analyzeStructAccess(Token *token);
 	void analyzeGet(const Token *token);
 	bool checkFunctionSignature(const std::string_view &signatureName,
 								const std::string_view &functionnName);
 	std::optional<FunctionSignature> checkBuiltinFunction(Token *token);
 
+	static bool containsImport(BlockQueue &blocks);
 	static bool isBinaryOperator(OperatorToken::OperatorTypes operatorType);
 	static bool isComparisonOperator(OperatorToken::OperatorTypes operatorType);
 	static std::optional<ValueType> getOperatorType(ValueType left, ValueType right,
 													const OperatorToken *operatorToken);
+	static std::optional<RPNValueType> getVectorOperatorType(const RPNValueType &left,
+														 const RPNValueType &right);
 };
 
 std::ostream &operator<<(std::ostream &stream, const AnalyzerValueType &valueType);
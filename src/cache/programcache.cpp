@@ -0,0 +1,735 @@
+#include "cache/programcache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+#include "codeblocks/codeblock.hpp"
+#include "codeblocks/functionblock.hpp"
+#include "codeblocks/functionsignatureline.hpp"
+#include "codeblocks/line.hpp"
+#include "modules/module.hpp"
+#include "tokens/tokens/fstringtoken.hpp"
+#include "tokens/tokens/keywordtoken.hpp"
+#include "tokens/tokens/operatortoken.hpp"
+#include "tokens/tokens/stringtoken.hpp"
+#include "tokens/tokens/typetoken.hpp"
+#include "tokens/tokens/valuetoken.hpp"
+#include "value/types.hpp"
+
+bool ProgramCache::enabled = true;
+
+namespace {
+
+constexpr std::array<char, 4> cacheMagic = {'R', 'P', 'N', 'C'};
+// must be increased each time the layout of the cache files changes
+constexpr uint32_t cacheFormat = 2;
+
+struct CacheHeader {
+	std::array<char, 4> magic;
+	uint32_t format;
+	uint64_t interpreter;
+	uint64_t sourceSize;
+	uint64_t sourceHash;
+	uint64_t payloadSize;
+	uint64_t payloadHash;
+};
+
+/**
+ * @brief a module imported by a compilation unit and the hash of the interface it had when the
+ * unit was analyzed
+ */
+struct ModuleDependency {
+	std::string name;
+	uint64_t interface;
+};
+
+enum class TokenKind : uint8_t { STRING, KEYWORD, OPERATOR, TYPE, VALUE, FSTRING };
+
+/**
+ * @brief identify the interpreter which writes or reads a cache file, the executable itself is
+ * part of it so a rebuilt interpreter never uses blocks analyzed by another build
+ *
+ * @return uint64_t the identifier of the interpreter
+ */
+uint64_t interpreterVersion() {
+	static const uint64_t version = [] {
+		std::string identifier = RPN_VERSION;
+		struct stat executable {};
+		if (stat("/proc/self/exe", &executable) == 0) {
+			identifier += ':' + std::to_string(executable.st_size) + ':' +
+						  std::to_string(executable.st_mtim.tv_sec) + '.' +
+						  std::to_string(executable.st_mtim.tv_nsec);
+		}
+		return std::hash<std::string>()(identifier);
+	}();
+	return version;
+}
+
+std::string cacheDirectory() {
+	if (const char *cacheHome = std::getenv("XDG_CACHE_HOME");
+		cacheHome != nullptr && cacheHome[0] != '\0') {
+		return std::string(cacheHome) + "/rpnlang";
+	}
+	if (const char *home = std::getenv("HOME"); home != nullptr && home[0] != '\0') {
+		return std::string(home) + "/.cache/rpnlang";
+	}
+	return {};
+}
+
+/**
+ * @brief a cache file mapped in memory, the tokens of a loaded program reference their text in
+ * the mapping so it is kept until the end of the program
+ */
+class CacheMapping {
+  public:
+	CacheMapping(const char *data, size_t size) : data(data), size(size) {}
+	CacheMapping(const CacheMapping &other) = delete;
+	CacheMapping &operator=(const CacheMapping &other) = delete;
+	~CacheMapping() {
+		munmap(const_cast<char *>(this->data), this->size);
+	}
+
+	static std::unique_ptr<CacheMapping> open(const std::string &path) {
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			return nullptr;
+		}
+		struct stat fileStat {};
+		void *mapping = MAP_FAILED;
+		if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+			mapping =
+				mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		}
+		close(fd);
+		if (mapping == MAP_FAILED) {
+			return nullptr;
+		}
+		return std::make_unique<CacheMapping>(static_cast<const char *>(mapping),
+											  static_cast<size_t>(fileStat.st_size));
+	}
+
+	std::string_view getContent() const {
+		return {this->data, this->size};
+	}
+
+  private:
+	const char *data;
+	size_t size;
+};
+
+std::vector<std::unique_ptr<CacheMapping>> loadedMappings;
+
+class CacheWriter {
+  public:
+	template <typename T>
+	void write(T value) {
+		static_assert(std::is_trivially_copyable_v<T>);
+		this->buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+	}
+
+	void writeString(std::string_view value) {
+		this->write(static_cast<uint32_t>(value.size()));
+		this->buffer.append(value);
+	}
+
+	void writeRange(const TextRange &range) {
+		this->write<uint64_t>(range.line);
+		this->write<uint64_t>(range.columnStart);
+		this->write<uint64_t>(range.columnEnd);
+	}
+
+	void writeBaseType(const RPNBaseType &type) {
+		this->write(static_cast<uint8_t>(type.index()));
+		if (const auto *name = std::get_if<std::string>(&type)) {
+			this->writeString(*name);
+		} else {
+			this->write(static_cast<uint8_t>(std::get<ValueType>(type)));
+		}
+	}
+
+	void writeValueType(const RPNValueType &type) {
+		this->writeBaseType(type.getType());
+		this->writeBaseType(type.getListType());
+	}
+
+	void writeValue(const Value *value) {
+		this->write(static_cast<uint8_t>(value->getType()));
+		this->writeRange(value->getRange());
+		switch (value->getType()) {
+			case INT:
+				this->write(dynamic_cast<const Int *>(value)->getValue());
+				break;
+			case FLOAT:
+				this->write(dynamic_cast<const Float *>(value)->getValue());
+				break;
+			case BOOL:
+				this->write(static_cast<uint8_t>(dynamic_cast<const Bool *>(value)->getValue()));
+				break;
+			case STRING:
+			case VARIABLE:
+			case BUILTIN_VARIABLE:
+				this->writeString(value->getStringValue());
+				break;
+			case PATH:
+			case BUILTIN_PATH:
+			case STRUCT_ACCESS: {
+				const auto *path = dynamic_cast<const Path *>(value);
+				this->write(static_cast<uint32_t>(path->size()));
+				for (size_t i = 0; i < path->size(); i++) {
+					this->writeString(path->at(i));
+				}
+				this->write(static_cast<uint32_t>(path->getOffsets().size()));
+				for (const size_t offset : path->getOffsets()) {
+					this->write<uint64_t>(offset);
+				}
+				break;
+			}
+			default:
+				throw std::runtime_error("A " + stringType(value->getType()) +
+										 " value can't be cached");
+		}
+	}
+
+	void writeToken(Token *token) {
+		auto writeHeader = [this, token](TokenKind kind) {
+			this->write(kind);
+			this->write(token->getType());
+			this->writeRange(token->getRange());
+		};
+		if (const auto *valueToken = dynamic_cast<ValueToken *>(token)) {
+			writeHeader(TokenKind::VALUE);
+			this->writeValue(valueToken->getValue());
+		} else if (const auto *keywordToken = dynamic_cast<KeywordToken *>(token)) {
+			writeHeader(TokenKind::KEYWORD);
+			this->write(static_cast<uint32_t>(keywordToken->getKeyword()));
+		} else if (dynamic_cast<OperatorToken *>(token) != nullptr) {
+			writeHeader(TokenKind::OPERATOR);
+			this->writeString(token->getStringValue());
+		} else if (const auto *typeToken = dynamic_cast<TypeToken *>(token)) {
+			writeHeader(TokenKind::TYPE);
+			this->writeValueType(typeToken->getValueType());
+		} else if (const auto *fStringToken = dynamic_cast<FStringToken *>(token)) {
+			writeHeader(TokenKind::FSTRING);
+			this->write(static_cast<uint32_t>(fStringToken->size()));
+			for (const std::string &part : fStringToken->getParts()) {
+				this->writeString(part);
+			}
+		} else if (const auto *stringToken = dynamic_cast<StringToken *>(token)) {
+			writeHeader(TokenKind::STRING);
+			this->writeString(stringToken->getValue());
+		} else {
+			throw std::runtime_error("This token can't be cached");
+		}
+	}
+
+	void writeCodeBlock(CodeBlock *block) {
+		this->writeRange(block->getKeywordToken()->getRange());
+		this->write(static_cast<uint32_t>(block->getKeyword()));
+		this->writeBlocks(block->getBlocks());
+		this->write(static_cast<uint8_t>(block->getNext() != nullptr));
+		if (block->getNext() != nullptr) {
+			this->writeCodeBlock(block->getNext());
+		}
+	}
+
+	void writeBlock(BaseBlock *block) {
+		this->write(block->getType());
+		switch (block->getType()) {
+			case blockType::LINE_BLOCK: {
+				auto *line = dynamic_cast<Line *>(block);
+				this->write(static_cast<uint32_t>(line->totalSize()));
+				this->write(static_cast<uint32_t>(line->totalSize() - line->size()));
+				for (Token *token : *line) {
+					this->writeToken(token);
+				}
+				break;
+			}
+			case blockType::CODE_BLOCK:
+				this->writeCodeBlock(dynamic_cast<CodeBlock *>(block));
+				break;
+			case blockType::FUNCTION_BLOCK: {
+				const auto *function = dynamic_cast<FunctionBlock *>(block);
+				this->writeString(function->getName());
+				const RPNFunctionArgs args = function->getArgs();
+				this->write(static_cast<uint32_t>(args.size()));
+				for (const auto &[name, type] : args) {
+					this->writeString(name);
+					this->writeValueType(type);
+				}
+				this->writeValueType(function->getReturnType());
+				this->writeCodeBlock(function->getBody());
+				break;
+			}
+			case blockType::FUNCTION_SIGNATURE: {
+				const auto *signatureLine = dynamic_cast<FunctionSignatureLine *>(block);
+				const FunctionSignature signature = signatureLine->getSignature();
+				this->writeString(signatureLine->getName());
+				this->write(static_cast<uint32_t>(signature.args.size()));
+				for (const RPNValueType &type : signature.args) {
+					this->writeValueType(type);
+				}
+				this->writeValueType(signature.returnType);
+				this->write(static_cast<uint8_t>(signature.builtin));
+				this->write(static_cast<uint8_t>(signature.callable));
+				this->write(static_cast<uint8_t>(signature.returnRule));
+				this->writeRange(signatureLine->lastRange());
+				break;
+			}
+		}
+	}
+
+	void writeBlocks(BlockQueue &blocks) {
+		uint32_t count = 0;
+		for ([[maybe_unused]] BaseBlock *block : blocks) {
+			count++;
+		}
+		this->write(count);
+		for (BaseBlock *block : blocks) {
+			this->writeBlock(block);
+		}
+	}
+
+	const std::string &getBuffer() const {
+		return this->buffer;
+	}
+
+  private:
+	std::string buffer;
+};
+
+/**
+ * @brief rebuild the blocks written by a CacheWriter in the arena of a compilation unit, the
+ * texts of the string tokens are views on the cache file
+ */
+class CacheReader {
+  public:
+	CacheReader(std::string_view data, Arena &arena)
+		: data(data), arena(arena), currentLine(arena.create<Line>(arena)) {}
+
+	template <typename T>
+	T read() {
+		static_assert(std::is_trivially_copyable_v<T>);
+		if (this->data.size() < sizeof(T)) {
+			throw std::runtime_error("Truncated program cache");
+		}
+		T value;
+		std::memcpy(&value, this->data.data(), sizeof(T));
+		this->data.remove_prefix(sizeof(T));
+		return value;
+	}
+
+	std::string_view readString() {
+		const auto size = this->read<uint32_t>();
+		if (this->data.size() < size) {
+			throw std::runtime_error("Truncated program cache");
+		}
+		std::string_view value = this->data.substr(0, size);
+		this->data.remove_prefix(size);
+		return value;
+	}
+
+	TextRange readRange() {
+		const auto line = this->read<uint64_t>();
+		const auto columnStart = this->read<uint64_t>();
+		const auto columnEnd = this->read<uint64_t>();
+		TextRange range;
+		range.line = line;
+		range.columnStart = columnStart;
+		range.columnEnd = columnEnd;
+		return range;
+	}
+
+	RPNBaseType readBaseType() {
+		if (this->read<uint8_t>() == 0) {
+			return std::string(this->readString());
+		}
+		return static_cast<ValueType>(this->read<uint8_t>());
+	}
+
+	RPNValueType readValueType() {
+		RPNBaseType type = this->readBaseType();
+		return {type, this->readBaseType()};
+	}
+
+	Value *readValue() {
+		const auto type = static_cast<ValueType>(this->read<uint8_t>());
+		const TextRange range = this->readRange();
+		switch (type) {
+			case INT:
+				return new Int(this->read<int64_t>(), range, Value::VALUE_TOKEN);
+			case FLOAT:
+				return new Float(this->read<float>(), range, Value::VALUE_TOKEN);
+			case BOOL:
+				return new Bool(this->read<uint8_t>() != 0, range, Value::VALUE_TOKEN);
+			case STRING:
+				return new String(this->readString(), range, Value::VALUE_TOKEN);
+			case VARIABLE:
+			case BUILTIN_VARIABLE: {
+				auto *variable = new Variable(this->readString(), range);
+				variable->setType(type);
+				return variable;
+			}
+			case PATH:
+			case BUILTIN_PATH:
+			case STRUCT_ACCESS: {
+				std::vector<std::string> names(this->read<uint32_t>());
+				for (std::string &name : names) {
+					name = this->readString();
+				}
+				std::vector<size_t> offsets(this->read<uint32_t>());
+				for (size_t &offset : offsets) {
+					offset = this->read<uint64_t>();
+				}
+				auto *path = new Path(names, range, type);
+				path->setOffsets(std::move(offsets));
+				return path;
+			}
+			default:
+				throw std::runtime_error("Invalid value in program cache");
+		}
+	}
+
+	Token *readToken() {
+		const auto kind = this->read<TokenKind>();
+		const auto type = this->read<TokenType>();
+		const TextRange range = this->readRange();
+		Token *token = nullptr;
+		switch (kind) {
+			case TokenKind::VALUE:
+				token = this->arena.create<ValueToken>(this->readValue(), type);
+				break;
+			case TokenKind::KEYWORD:
+				token = this->arena.create<KeywordToken>(
+					range, static_cast<KeywordEnum>(this->read<uint32_t>()));
+				break;
+			case TokenKind::OPERATOR:
+				token = this->arena.create<OperatorToken>(range, type, this->readString());
+				break;
+			case TokenKind::TYPE: {
+				const RPNValueType valueType = this->readValueType();
+				auto *typeToken = this->arena.create<TypeToken>(
+					range, stringType(std::get<ValueType>(valueType.getType())), type);
+				if (std::get<ValueType>(valueType.getType()) == LIST) {
+					typeToken->setListType(valueType.getListType());
+				}
+				token = typeToken;
+				break;
+			}
+			case TokenKind::FSTRING: {
+				std::vector<std::string> parts(this->read<uint32_t>());
+				for (std::string &part : parts) {
+					part = this->readString();
+				}
+				token = this->arena.create<FStringToken>(range, parts);
+				break;
+			}
+			case TokenKind::STRING:
+				token = this->arena.create<StringToken>(range, type, this->readString());
+				break;
+			default:
+				throw std::runtime_error("Invalid token in program cache");
+		}
+		token->setType(type);
+		token->setRange(range);
+		return token;
+	}
+
+	CodeBlock *readCodeBlock() {
+		const TextRange range = this->readRange();
+		const auto keywordType = static_cast<KeywordEnum>(this->read<uint32_t>());
+		auto *keyword = this->arena.create<KeywordToken>(range, keywordType);
+		auto *block = this->arena.create<CodeBlock>(keyword);
+		this->readBlocks(block->getBlocks());
+		if (this->read<uint8_t>() != 0) {
+			block->setNext(this->readCodeBlock());
+		}
+		return block;
+	}
+
+	BaseBlock *readBlock() {
+		switch (this->read<blockType>()) {
+			case blockType::LINE_BLOCK: {
+				const auto count = this->read<uint32_t>();
+				const auto currentToken = this->read<uint32_t>();
+				for (uint32_t i = 0; i < count; i++) {
+					this->currentLine->push(this->readToken());
+				}
+				for (uint32_t i = 0; i < currentToken; i++) {
+					this->currentLine->pop();
+				}
+				Line *line = this->arena.create<Line>(this->arena, *this->currentLine);
+				this->currentLine->clear();
+				return line;
+			}
+			case blockType::CODE_BLOCK:
+				return this->readCodeBlock();
+			case blockType::FUNCTION_BLOCK: {
+				const std::string name(this->readString());
+				RPNFunctionArgs args(this->read<uint32_t>());
+				for (auto &[argName, type] : args) {
+					argName = this->readString();
+					type = this->readValueType();
+				}
+				const RPNValueType returnType = this->readValueType();
+				return this->arena.create<FunctionBlock>(name, args, returnType,
+														 this->readCodeBlock());
+			}
+			case blockType::FUNCTION_SIGNATURE: {
+				const std::string_view name = this->readString();
+				FunctionSignature signature{};
+				signature.args.resize(this->read<uint32_t>());
+				for (RPNValueType &type : signature.args) {
+					type = this->readValueType();
+				}
+				signature.returnType = this->readValueType();
+				signature.builtin = this->read<uint8_t>() != 0;
+				signature.callable = this->read<uint8_t>() != 0;
+				signature.returnRule = static_cast<ReturnRule>(this->read<uint8_t>());
+				return this->arena.create<FunctionSignatureLine>(signature, name,
+																 this->readRange());
+			}
+			default:
+				throw std::runtime_error("Invalid block in program cache");
+		}
+	}
+
+	void readBlocks(BlockQueue &blocks) {
+		const auto count = this->read<uint32_t>();
+		for (uint32_t i = 0; i < count; i++) {
+			blocks.push(this->readBlock());
+		}
+	}
+
+  private:
+	std::string_view data;
+	Arena &arena;
+	Line *currentLine;
+};
+
+} // namespace
+
+/**
+ * @brief prepare the cache of a source file, nothing is read or written until load or store is
+ * called
+ *
+ * @param sourcePath the path of the source file
+ * @param source the mapped source file
+ */
+ProgramCache::ProgramCache(std::string_view sourcePath, SourceFile &source) : source(source) {
+	const std::string directory = cacheDirectory();
+	std::error_code error;
+	const std::filesystem::path absolutePath = std::filesystem::absolute(sourcePath, error);
+	if (!ProgramCache::enabled || directory.empty() || error) {
+		return;
+	}
+	std::array<char, 16> name{};
+	auto [end, _] = std::to_chars(name.data(), name.data() + name.size(),
+								  std::hash<std::string>()(absolutePath.string()), 16);
+	this->cachePath = directory + "/" + std::string(name.data(), end) + ".rpnc";
+}
+
+/**
+ * @brief load the blocks of the source from the cache. The imports made when the source was
+ * analyzed are replayed first, the blocks are only used if the interfaces of the imported modules
+ * didn't change since then. The analysis makes the same imports when the cache can't be used so
+ * the modules are not loaded twice
+ *
+ * @param context the context of the compilation unit
+ * @return std::optional<ExpressionResult> the result of the imports, nothing if the cache can't be
+ * used
+ */
+std::optional<ExpressionResult> ProgramCache::load(const ContextPtr &context) {
+	if (this->cachePath.empty()) {
+		return std::nullopt;
+	}
+	std::unique_ptr<CacheMapping> mapping = CacheMapping::open(this->cachePath);
+	if (mapping == nullptr || mapping->getContent().size() < sizeof(CacheHeader)) {
+		return std::nullopt;
+	}
+	CacheHeader header{};
+	std::memcpy(&header, mapping->getContent().data(), sizeof(CacheHeader));
+	const std::string_view payload = mapping->getContent().substr(sizeof(CacheHeader));
+	if (header.magic != cacheMagic || header.format != cacheFormat ||
+		header.interpreter != interpreterVersion() ||
+		header.sourceSize != this->source.getContent().size() ||
+		header.sourceHash != this->source.getHash() || header.payloadSize != payload.size() ||
+		header.payloadHash != std::hash<std::string_view>()(payload)) {
+		return std::nullopt;
+	}
+
+	CacheReader reader(payload, this->source.getArena());
+	std::vector<ModuleDependency> dependencies;
+	std::vector<ModuleImport> imports;
+	try {
+		dependencies.resize(reader.read<uint32_t>());
+		for (ModuleDependency &dependency : dependencies) {
+			dependency.name = reader.readString();
+			dependency.interface = reader.read<uint64_t>();
+		}
+		imports.resize(reader.read<uint32_t>());
+		for (ModuleImport &moduleImport : imports) {
+			moduleImport.path = reader.readString();
+			moduleImport.name = reader.readString();
+			moduleImport.range = reader.readRange();
+		}
+	} catch (const std::runtime_error &) {
+		return std::nullopt;
+	}
+
+	for (const ModuleImport &moduleImport : imports) {
+		ExpressionResult result =
+			Module::addModule(moduleImport.path, moduleImport.name, moduleImport.range, context);
+		if (result.error()) {
+			return result;
+		}
+	}
+	for (const ModuleDependency &dependency : dependencies) {
+		std::shared_ptr<Module> module = Module::getModule(dependency.name);
+		if (module == nullptr || module->getInterfaceHash() != dependency.interface) {
+			// the analysis records the imports again
+			Module::takeImports(context);
+			return std::nullopt;
+		}
+	}
+
+	try {
+		const auto structCount = reader.read<uint32_t>();
+		for (uint32_t i = 0; i < structCount; i++) {
+			StructDefinition definition(reader.readString());
+			const auto memberCount = reader.read<uint32_t>();
+			for (uint32_t j = 0; j < memberCount; j++) {
+				const std::string_view member = reader.readString();
+				definition.addMember(member, reader.readValueType());
+			}
+			Struct::addStructDefinition(definition);
+			this->structDefinitions.push_back(definition);
+		}
+
+		reader.readBlocks(this->blocks);
+	} catch (const std::runtime_error &) {
+		// the payload hash matched so this only happens if the writer and the reader disagree
+		this->blocks.clear();
+		this->structDefinitions.clear();
+		Module::takeImports(context);
+		return std::nullopt;
+	}
+	loadedMappings.push_back(std::move(mapping));
+	return ExpressionResult();
+}
+
+/**
+ * @brief write the analyzed blocks of the source in its cache file with the interfaces of the
+ * modules it imports. Nothing is written if a block can't be cached or if an imported module is
+ * still being loaded, in which case its interface is not known yet
+ *
+ * @param blocks the analyzed blocks of the source
+ * @param structDefinitions the structs defined by the source
+ * @param imports the imports made by the analysis of the source
+ */
+void ProgramCache::store(BlockQueue &blocks, const std::vector<StructDefinition> &structDefinitions,
+						 const std::vector<ModuleImport> &imports) {
+	if (this->cachePath.empty()) {
+		return;
+	}
+
+	std::vector<ModuleDependency> dependencies;
+	for (const ModuleImport &moduleImport : imports) {
+		if (moduleImport.path == moduleImport.name ||
+			std::ranges::find(dependencies, moduleImport.name, &ModuleDependency::name) !=
+				dependencies.end()) {
+			continue;
+		}
+		std::shared_ptr<Module> module = Module::getModule(moduleImport.name);
+		if (module == nullptr || module->getInterfaceHash() == 0) {
+			return;
+		}
+		dependencies.push_back({moduleImport.name, module->getInterfaceHash()});
+	}
+
+	CacheWriter writer;
+	try {
+		writer.write(static_cast<uint32_t>(dependencies.size()));
+		for (const ModuleDependency &dependency : dependencies) {
+			writer.writeString(dependency.name);
+			writer.write(dependency.interface);
+		}
+
+		writer.write(static_cast<uint32_t>(imports.size()));
+		for (const ModuleImport &moduleImport : imports) {
+			writer.writeString(moduleImport.path);
+			writer.writeString(moduleImport.name);
+			writer.writeRange(moduleImport.range);
+		}
+
+		writer.write(static_cast<uint32_t>(structDefinitions.size()));
+		for (const StructDefinition &definition : structDefinitions) {
+			writer.writeString(definition.getName());
+			writer.write(static_cast<uint32_t>(definition.getMembersCount()));
+			const std::vector<std::string> members = definition.getMembersOrder();
+			for (size_t i = 0; i < members.size(); i++) {
+				writer.writeString(members[i]);
+				writer.writeValueType(definition.getMemberType(i));
+			}
+		}
+
+		writer.writeBlocks(blocks);
+	} catch (const std::runtime_error &) {
+		return;
+	}
+
+	const std::string &payload = writer.getBuffer();
+	const CacheHeader header{cacheMagic,
+							 cacheFormat,
+							 interpreterVersion(),
+							 this->source.getContent().size(),
+							 this->source.getHash(),
+							 payload.size(),
+							 std::hash<std::string_view>()(payload)};
+
+	// the file is renamed once complete so another interpreter never maps a partial file
+	std::error_code error;
+	const std::filesystem::path directory = std::filesystem::path(this->cachePath).parent_path();
+	std::filesystem::create_directories(directory, error);
+	const std::string temporaryPath = this->cachePath + "." + std::to_string(getpid());
+	std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char *>(&header), sizeof(CacheHeader));
+	file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+	file.close();
+	if (!file) {
+		std::filesystem::remove(temporaryPath, error);
+		return;
+	}
+	std::filesystem::rename(temporaryPath, this->cachePath, error);
+}
+
+BlockQueue &ProgramCache::getBlocks() {
+	return this->blocks;
+}
+
+/**
+ * @brief get the structs defined by the source, they are known once the cache is loaded
+ *
+ * @return const std::vector<StructDefinition>& the struct definitions in declaration order
+ */
+const std::vector<StructDefinition> &ProgramCache::getStructDefinitions() const {
+	return this->structDefinitions;
+}
+
+void ProgramCache::setEnabled(bool enabled) {
+	ProgramCache::enabled = enabled;
+}
+
+bool ProgramCache::isEnabled() {
+	return ProgramCache::enabled;
+}
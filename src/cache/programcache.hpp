@@ -0,0 +1,43 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arena/arena.hpp"
+#include "codeblocks/blockqueue.hpp"
+#include "context/context.hpp"
+#include "expressionresult/expressionresult.hpp"
+#include "modules/moduleimport.hpp"
+#include "textutilities/sourcefile.hpp"
+#include "value/types/struct.hpp"
+
+/**
+ * @brief binary cache of the analyzed blocks of a source file. The cache file is keyed by the
+ * content of the source and the version of the interpreter, it is invalidated when the interface
+ * of a module imported by the source changes. The cache files are stored in the user cache
+ * directory and mapped in memory when they are loaded
+ */
+class ProgramCache {
+  public:
+	ProgramCache(std::string_view sourcePath, SourceFile &source);
+
+	std::optional<ExpressionResult> load(const ContextPtr &context);
+	void store(BlockQueue &blocks, const std::vector<StructDefinition> &structDefinitions,
+			   const std::vector<ModuleImport> &imports);
+
+	BlockQueue &getBlocks();
+	const std::vector<StructDefinition> &getStructDefinitions() const;
+
+	static void setEnabled(bool enabled);
+	static bool isEnabled();
+
+  private:
+	SourceFile &source;
+	std::string cachePath;
+	BlockQueue blocks;
+	std::vector<StructDefinition> structDefinitions;
+
+	static bool enabled;
+};
@@ -42,10 +42,10 @@ size_t BlockQueue::size() const {
 	return this->blocks.size() - this->currentBlock;
 }
 
+/**
+ * @brief remove the blocks from the queue, they are still owned by the arena
+ */
 void BlockQueue::clear() {
-	for (auto *block : this->blocks) {
-		delete block;
-	}
 	this->blocks.clear();
 }
 
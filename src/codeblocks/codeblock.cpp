@@ -3,13 +3,6 @@
 CodeBlock::CodeBlock(KeywordToken *keyword)
 	: BaseBlock(blockType::CODE_BLOCK), keyword(keyword), next(nullptr) {}
 
-CodeBlock::~CodeBlock() {
-	this->clear();
-	delete this->keyword;
-	if (this->next != nullptr)
-		delete this->next;
-}
-
 void CodeBlock::push(BaseBlock *block) {
 	blocks.push(block);
 }
@@ -9,7 +9,6 @@
 class CodeBlock : public BaseBlock {
   public:
 	CodeBlock(KeywordToken *keyword);
-	~CodeBlock();
 	void push(BaseBlock *block);
 	BlockQueue &getBlocks();
 
@@ -1,13 +1,32 @@
 #include "codeblocks/line.hpp"
 
-Line::Line() : BaseBlock(blockType::LINE_BLOCK) {}
+#include <algorithm>
 
-Line::~Line() {
-	clear();
+Line::Line(Arena &arena) : BaseBlock(blockType::LINE_BLOCK), arena(arena) {}
+
+/**
+ * @brief copy a line in the arena, the storage of the copy has the exact size of the line
+ *
+ * @param arena the arena which owns the copy
+ * @param line the line to copy, usually the line which is being built by the lexer
+ */
+Line::Line(Arena &arena, const Line &line)
+	: BaseBlock(blockType::LINE_BLOCK), arena(arena),
+	  tokens(arena.allocateArray<Token *>(line.count)), count(line.count), capacity(line.count),
+	  currentToken(line.currentToken) {
+	std::copy(line.tokens, line.tokens + line.count, this->tokens);
 }
 
 void Line::push(Token *token) {
-	this->tokens.push_back(token);
+	if (this->count == this->capacity) {
+		// the previous storage stays in the arena, the lexer builds all the lines in the same
+		// line and copies them so this only happens for the longest lines
+		this->capacity = this->capacity == 0 ? 8 : this->capacity * 2;
+		Token **tokens = this->arena.allocateArray<Token *>(this->capacity);
+		std::copy(this->tokens, this->tokens + this->count, tokens);
+		this->tokens = tokens;
+	}
+	this->tokens[this->count++] = token;
 }
 
 Token *Line::pop() {
@@ -21,11 +40,11 @@ Token *Line::top() {
 }
 
 Token *Line::back() {
-	return this->tokens[this->tokens.size() - 1];
+	return this->tokens[this->count - 1];
 }
 
 Token *Line::last() {
-	if (this->tokens.empty()) {
+	if (this->count == 0) {
 		throw std::runtime_error("Line::last() called on empty stack");
 	}
 	if (this->currentToken == 0) {
@@ -42,27 +61,28 @@ void Line::goBack() {
 }
 
 bool Line::empty() const {
-	return this->currentToken >= this->tokens.size();
+	return this->currentToken >= this->count;
 }
 
 size_t Line::size() const {
-	return this->tokens.size() - this->currentToken;
+	return this->count - this->currentToken;
 }
 
 size_t Line::totalSize() const {
-	return this->tokens.size();
+	return this->count;
 }
 
+/**
+ * @brief remove the tokens from the line, they are still owned by the arena
+ */
 void Line::clear() {
-	for (auto *token : this->tokens) {
-		delete token;
-	}
-	this->tokens.clear();
+	this->count = 0;
+	this->currentToken = 0;
 }
 
 void Line::display() const {
 	std::cout << "Line: ";
-	std::cout << this->tokens << ";" << std::endl;
+	std::cout << std::vector<Token *>(this->tokens, this->tokens + this->count) << ";" << std::endl;
 }
 
 /**
@@ -74,17 +94,17 @@ void Line::reset() {
 }
 
 TextRange Line::lastRange() const {
-	if (this->tokens.empty()) {
+	if (this->count == 0) {
 		throw std::runtime_error("Line::lastRange() called on empty stack");
 	}
-	return this->tokens.back()->getRange();
+	return this->tokens[this->count - 1]->getRange();
 }
 
 TextRange Line::lineRange() const {
-	if (this->tokens.empty()) {
+	if (this->count == 0) {
 		throw std::runtime_error("Line::lineRange() called on empty stack");
 	}
-	return TextRange::merge(this->tokens.front()->getRange(), this->tokens.back()->getRange());
+	return TextRange::merge(this->tokens[0]->getRange(), this->tokens[this->count - 1]->getRange());
 }
 
 LineIterator Line::begin() {
@@ -92,7 +112,7 @@ LineIterator Line::begin() {
 }
 
 LineIterator Line::end() {
-	return {this, this->tokens.size()};
+	return {this, this->count};
 }
 
 // Iterator implementation
@@ -130,7 +150,7 @@ bool LineIterator::operator!=(const LineIterator &other) const {
 }
 
 LineIterator::operator bool() const {
-	return this->currentToken < this->line->tokens.size();
+	return this->currentToken < this->line->count;
 }
 
 Line *LineIterator::getLine() const {
@@ -1,14 +1,22 @@
 #pragma once
 
+#include "arena/arena.hpp"
 #include "codeblocks/baseblock.hpp"
 #include "tokens/token.hpp"
+#include <cstdint>
 #include <vector>
 
 class LineIterator;
+
+/**
+ * @brief a line of tokens, the tokens and the line itself are owned by the arena of the
+ * compilation unit. The token pointers are stored contiguously in the arena too
+ */
 class Line : public BaseBlock {
   public:
-	Line();
-	~Line() override;
+	explicit Line(Arena &arena);
+	Line(Arena &arena, const Line &line);
+	~Line() override = default;
 	void push(Token *token);
 	bool empty() const override;
 	size_t size() const;
@@ -29,8 +37,11 @@ class Line : public BaseBlock {
 	LineIterator end();
 
   private:
-	std::vector<Token *> tokens;
-	long unsigned int currentToken = 0;
+	Arena &arena;
+	Token **tokens = nullptr;
+	uint32_t count = 0;
+	uint32_t capacity = 0;
+	uint32_t currentToken = 0;
 
 	friend class LineIterator;
 };
@@ -56,4 +67,7 @@ class LineIterator {
 	long unsigned int currentToken;
 
 	friend class Line;
-};
\ No newline at end of file
+};
+
+template <>
+struct ArenaTriviallyDestructible<Line> : std::true_type {};
\ No newline at end of file
@@ -1,55 +1,78 @@
 #include "interpreter/interpreter.hpp"
 
+#include "counters/counters.hpp"
+#include "runtimestats/runtimestats.hpp"
+
+unsigned int Interpreter::instances = 0;
+
 Interpreter::Interpreter()
-	: lastValue(nullptr), context(std::make_shared<Context>("main", "<stdin>")) {}
+	: lastValue(nullptr), context(std::make_shared<Context>("main", "<stdin>")) {
+	Interpreter::instances++;
+}
 
-Interpreter::Interpreter(ContextPtr ctx) : lastValue(nullptr), context(ctx) {}
+Interpreter::Interpreter(ContextPtr ctx) : lastValue(nullptr), context(ctx) {
+	Interpreter::instances++;
+}
 
 Interpreter::~Interpreter() {
 	this->clearMemory();
+	Interpreter::instances--;
 }
 
 void Interpreter::clearMemory() {
 	Value::deleteValue(&this->lastValue, Value::INTERPRETER);
 	this->memory.clear();
+	// the temporary values are only all released when no other interpreter is running
+	if (Interpreter::instances == 1) {
+		Profiler::reportLeaks(std::cerr);
+	}
 }
 
 bool Interpreter::interpretFile(std::string_view fileName, std::string &errorString,
 								bool isModule) {
-	std::ifstream file;
-	if (!openFile(file, fileName, errorString)) {
+	ImportGraph::Timer timer(fileName);
+	Profiler::define(this->context.get(), fileName, fileName);
+	// until the first line runs the samples of the file are its compilation
+	Profiler::Frame frame(this->context.get(), 0);
+	SourceFile *source = nullptr;
+	{
+		const Phases::Scope phase("read", this->context->getName());
+		source = SourceFile::open(fileName, errorString);
+	}
+	if (source == nullptr) {
 		return false;
 	}
 
-	bool error = false;
-	std::deque<Token *> tokens;
-	std::string instruction;
-	int line = 0;
-	ExpressionResult result;
-	while (!error && std::getline(file, instruction)) {
-		line++;
-		result = Lexer::tokenize(line, instruction, tokens, this->context);
-		if (result.error()) {
-			result.display();
-			error = true;
-		}
-		tokens.push_back(
-			new StringToken(line, instruction.size(), TokenType::TOKEN_TYPE_END_OF_LINE, "\n"));
-	}
-	file.close();
-
-	if (error) {
-		return false;
+	ProgramCache cache(fileName, *source);
+	Lexer lexer({}, source->getArena(), this->context);
+	std::optional<Tracer::Span> compileSpan(std::in_place, "compile", fileName);
+	std::optional<Phases::Scope> cachePhase(std::in_place, "cache", this->context->getName());
+	std::optional<ExpressionResult> cached = cache.load(this->context);
+	cachePhase.reset();
+	if (ProgramCache::isEnabled()) {
+		RuntimeStats::cacheLookup(cached.has_value());
 	}
-	Lexer lexer(tokens, this->context);
-	result = lexer.lex();
+	ExpressionResult result =
+		cached.has_value() ? cached.value() : lexer.lexLines(source->getLines());
+	this->imports = Module::takeImports(this->context);
 	if (result.error()) {
 		result.display();
 		return false;
 	}
+	if (cached.has_value()) {
+		this->structDefinitions = cache.getStructDefinitions();
+	} else {
+		this->structDefinitions = lexer.getStructDefinitions();
+		const Phases::Scope phase("cache", this->context->getName());
+		cache.store(lexer.getBlocks(), this->structDefinitions, this->imports);
+	}
+	timer.compiled(cached.has_value());
+	compileSpan.reset();
+	const Tracer::Span runSpan("run", fileName);
+	std::optional<Phases::Scope> runPhase(std::in_place, "run", this->context->getName());
 
 	Value::deleteValue(&this->lastValue, Value::INTERPRETER);
-	result = this->interpret(lexer.getBlocks());
+	result = this->interpret(cached.has_value() ? cache.getBlocks() : lexer.getBlocks());
 	if (result.error()) {
 		result.display();
 		return false;
@@ -71,9 +94,14 @@ bool Interpreter::interpretFile(std::string_view fileName, std::string &errorStr
 		}
 	}
 
+	runPhase.reset();
+	const Phases::Scope shutdownPhase("shutdown", this->context->getName());
 	if (isModule) {
 		this->context->takeOwnership();
 	} else {
+		// the last value can be a variable of the context
+		Value::deleteValue(&this->lastValue, Value::INTERPRETER);
+		this->lastValue = nullptr;
 		this->context->clear();
 	}
 
@@ -93,6 +121,14 @@ Value *&Interpreter::getLastValue() {
 	return this->lastValue;
 }
 
+const std::vector<StructDefinition> &Interpreter::getStructDefinitions() const {
+	return this->structDefinitions;
+}
+
+const std::vector<ModuleImport> &Interpreter::getImports() const {
+	return this->imports;
+}
+
 /**
  * @brief check if memory contains less than 1 value at the end of the interpretation
  *
@@ -130,6 +166,13 @@ ExpressionResult Interpreter::interpret(BlockQueue &blocks) {
 			}
 		} else if (block->getType() == blockType::FUNCTION_BLOCK) {
 			FunctionBlock const *f = dynamic_cast<FunctionBlock *>(block);
+			if (Profiler::isRunning()) {
+				// the shell and the pipe have no file path, their functions keep the context name
+				const bool inFile = this->context->hasParentType(CONTEXT_TYPE_FILE) ||
+									this->context->hasParentType(CONTEXT_TYPE_MODULE);
+				Profiler::define(f->getFunction(), f->getName(),
+								 inFile ? this->context->getFilePath() : this->context->getName());
+			}
 			this->context->setValue(f->getName(), new Function(f->getFunction(), f->lastRange(),
 															   Value::CONTEXT_VARIABLE));
 		} else if (block->getType() == blockType::FUNCTION_SIGNATURE) {
@@ -152,12 +195,16 @@ ExpressionResult Interpreter::interpretLine(Line &line, bool clearMemory) {
 	ExpressionResult result;
 	LineIterator it = line.begin();
 	while (!result.stopInterpret() && it) {
+		RPN_COUNT(TOKENS);
+		if (Profiler::isRunning()) {
+			Profiler::setToken((*it)->getRange());
+		}
 		switch ((*it)->getType()) {
 			case TokenType::TOKEN_TYPE_VALUE:
 			case TokenType::TOKEN_TYPE_LITERAL:
 			case TokenType::TOKEN_TYPE_PATH:
 			case TokenType::TOKEN_TYPE_STRUCT_ACCESS:
-				this->memory.push(dynamic_cast<ValueToken *>(*it)->getValue());
+				this->memory.push(dynamic_cast<ValueToken *>(*it)->getValue(), (*it)->getRange());
 				break;
 			case TokenType::TOKEN_TYPE_OPERATOR:
 			case TokenType::TOKEN_TYPE_BOOLEAN_OPERATOR:
@@ -241,6 +288,9 @@ void Interpreter::interpretFString(const FStringToken *token) {
 ExpressionResult Interpreter::interpretOperator(const OperatorToken *operatorToken) {
 	Value *right = nullptr;
 	Value *left = nullptr;
+	// the errors are located with the ranges of the operand tokens, the values can be shared
+	// constants which have no range
+	const TextRange rightRange = this->memory.topRange();
 	right = this->memory.popVariableValue(this->context);
 
 	// check for 0 division error
@@ -250,20 +300,34 @@ ExpressionResult Interpreter::interpretOperator(const OperatorToken *operatorTok
 			(right->getType() == FLOAT && dynamic_cast<Float *>(right)->getValue() == 0) ||
 			(right->getType() == BOOL &&
 			 static_cast<int>(dynamic_cast<Bool *>(right)->getValue()) == 0)) {
-			return {"Division by 0", right->getRange(), this->context};
+			return {"Division by 0", rightRange, this->context};
 		}
 	}
+	const TextRange leftRange = this->memory.topRange();
 	left = this->memory.popVariableValue(this->context);
 
-	if ((left->getType() == STRING || left->getType() == LIST)) {
+	if (operatorToken->isVectorOperator()) {
+		if (ExpressionResult result =
+				this->checkVectorOperands(left, right, leftRange, rightRange, operatorToken);
+			result.error()) {
+			Value::deleteValue(&right, Value::INTERPRETER);
+			if (right != left) {
+				Value::deleteValue(&left, Value::INTERPRETER);
+			}
+			return result;
+		}
+	} else if (operatorToken->getOperatorType() == OperatorToken::OP_MUL &&
+			   (left->getType() == STRING || left->getType() == LIST)) {
 		Int const *number = dynamic_cast<Int *>(right);
 		if (number && number->getValue() < 0) {
-			return {"Cannot multiply list like object by a negative number", right->getRange(),
+			return {"Cannot multiply list like object by a negative number", rightRange,
 					this->context};
 		}
 	}
 
-	this->memory.push(left->applyOperator(right, operatorToken, this->context));
+	RPN_COUNT_OPERATOR(operatorToken->getOperatorType(), left->getType(), right->getType());
+	this->memory.push(left->applyOperator(right, operatorToken, this->context),
+					  TextRange::merge(leftRange, rightRange).merge(operatorToken->getRange()));
 	Value::deleteValue(&right, Value::INTERPRETER);
 	if (right != left) {
 		Value::deleteValue(&left, Value::INTERPRETER);
@@ -272,6 +336,56 @@ ExpressionResult Interpreter::interpretOperator(const OperatorToken *operatorTok
 	return {};
 }
 
+/**
+ * @brief Check that the operands of an element-wise operator are numbers or numeric lists, that
+ * lists have the same size and that there is no division by 0
+ *
+ * @param left the left operand
+ * @param right the right operand
+ * @param leftRange the range of the left operand tokens
+ * @param rightRange the range of the right operand tokens
+ * @param operatorToken the element-wise operator
+ * @return ExpressionResult an error if the operator can't be applied
+ */
+ExpressionResult Interpreter::checkVectorOperands(const Value *left, const Value *right,
+												  const TextRange &leftRange,
+												  const TextRange &rightRange,
+												  const OperatorToken *operatorToken) const {
+	const auto *leftList = dynamic_cast<const List *>(left);
+	const auto *rightList = dynamic_cast<const List *>(right);
+	if (leftList == nullptr && rightList == nullptr) {
+		return {"Operator " + operatorToken->getStringValue() + " needs at least one list",
+				operatorToken->getRange(), this->context};
+	}
+	for (const auto &[operand, range] : {std::pair{left, leftRange}, {right, rightRange}}) {
+		const auto *list = dynamic_cast<const List *>(operand);
+		if ((list == nullptr && !operand->isNumber()) || (list != nullptr && !list->isNumeric())) {
+			return {"Operator " + operatorToken->getStringValue() +
+						" can only be applied to numbers and lists of numbers",
+					range, this->context};
+		}
+	}
+	if (leftList != nullptr && rightList != nullptr && leftList->size() != rightList->size()) {
+		return {"Cannot apply operator " + operatorToken->getStringValue() +
+					" to lists of different sizes (" + std::to_string(leftList->size()) + " and " +
+					std::to_string(rightList->size()) + ")",
+				TextRange::merge(leftRange, rightRange), this->context};
+	}
+	if (operatorToken->getOperatorType() == OperatorToken::OP_VDIV) {
+		bool const zero =
+			rightList != nullptr
+				? std::ranges::any_of(rightList->toFloats(), [](float value) { return value == 0; })
+				: (right->getType() == INT && dynamic_cast<const Int *>(right)->getValue() == 0) ||
+					  (right->getType() == FLOAT &&
+					   dynamic_cast<const Float *>(right)->getValue() == 0) ||
+					  (right->getType() == BOOL && !dynamic_cast<const Bool *>(right)->getValue());
+		if (zero) {
+			return {"Division by 0", rightRange, this->context};
+		}
+	}
+	return {};
+}
+
 ExpressionResult Interpreter::interpretKeyword(const Token *keywordToken) {
 	switch (dynamic_cast<const KeywordToken *>(keywordToken)->getKeyword()) {
 		case KEYWORD_BREAK:
@@ -297,19 +411,22 @@ ExpressionResult Interpreter::interpretValueType(const Token *typeToken) {
 	if (type == LIST && !RPNValueType::isCastableTo(this->memory.top()->getType(), LIST)) {
 		return this->interpretList(typeToken);
 	}
+	const TextRange range = TextRange::merge(this->memory.topRange(), typeToken->getRange());
 	Value *top = this->memory.popVariableValue(this->context);
 	Value *value = top->to(type, Value::INTERPRETER);
 	Value::deleteValue(&top, Value::INTERPRETER);
-	this->memory.push(value);
+	this->memory.push(value, range);
 	return {};
 }
 
 void Interpreter::interpretAssignment(const Token * /*operatorToken*/) {
-	bool const copy = this->memory.top()->getType() == VARIABLE ||
-					  this->memory.top()->getType() == PATH ||
-					  this->memory.top()->getOwner() == Value::OBJECT_VALUE;
+	bool copy = this->memory.top()->getType() == VARIABLE ||
+				this->memory.top()->getType() == PATH ||
+				this->memory.top()->getOwner() == Value::OBJECT_VALUE;
 
 	Value *left = this->memory.popVariableValue(this->context);
+	// a list element or a struct member stays in its object
+	copy = copy || left->getOwner() == Value::OBJECT_VALUE;
 	Value *hold = nullptr;
 	if (this->memory.top()->getType() == VARIABLE) {
 		this->context->setValue(this->memory.top(), copy ? left->copy() : left, &hold);
@@ -317,13 +434,23 @@ void Interpreter::interpretAssignment(const Token * /*operatorToken*/) {
 		Path *path = dynamic_cast<Path *>(this->memory.top());
 		this->memory.pop();
 		Value *name = this->memory.pop();
-		Value *structValue = Struct::getStruct(name, path, this->context);
-		dynamic_cast<Struct *>(structValue)->setMember(path, copy ? left->copy() : left, &hold);
+		if (name->getType() == LIST_ELEMENT) {
+			dynamic_cast<ListElement *>(name)->setMember(path, copy ? left->copy() : left, &hold);
+		} else {
+			Value *structValue = Struct::getStruct(name, path, this->context);
+			dynamic_cast<Struct *>(structValue)->setMember(path, copy ? left->copy() : left, &hold);
+		}
 		this->memory.push(name);
 		this->memory.push(path);
 	} else {
 		ListElement *element = dynamic_cast<ListElement *>(this->memory.top());
-		element->set(copy ? left->copy() : left, &hold);
+		if (element->getList()->isColumnar()) {
+			// the members are copied in the list columns
+			element->set(left, &hold);
+			Value::deleteValue(&left, Value::INTERPRETER);
+		} else {
+			element->set(copy ? left->copy() : left, &hold);
+		}
 	}
 	if (this->lastValue == hold) {
 		this->lastValue = nullptr;
@@ -331,9 +458,12 @@ void Interpreter::interpretAssignment(const Token * /*operatorToken*/) {
 }
 
 const RPNFunction *Interpreter::getFunction(const Value *functionName) {
-	if (functionName->getType() != PATH &&
-		builtins::builtinFunctions.contains(functionName->getStringValue())) {
-		return &builtins::builtinFunctions.at(functionName->getStringValue());
+	if (functionName->getType() == VARIABLE || functionName->getType() == BUILTIN_VARIABLE) {
+		const BuiltinRPNFunction *builtin =
+			builtins::findSymbol(static_cast<const Variable *>(functionName)->getSymbol());
+		if (builtin != nullptr) {
+			return builtin;
+		}
 	}
 	return dynamic_cast<Function *>(functionName->getType() == VARIABLE
 										? this->context->getValue(functionName)
@@ -347,10 +477,20 @@ ExpressionResult Interpreter::interpretFunctionCall(Token *functionToken) {
 	function = this->getFunction(functionName);
 
 	std::vector<Value *> arguments;
+	TextRange range = functionName->getRange();
 	for (size_t i = 0; i < function->getArgumentsCount(); i++) {
+		if (i + 1 == function->getArgumentsCount()) {
+			range.merge(this->memory.topRange());
+		}
 		arguments.insert(arguments.begin(), this->memory.popVariableValue(this->context));
 	}
 
+	RPN_COUNT(FUNCTION_CALLS);
+	// the user functions record their own span
+	std::optional<Tracer::Span> builtinSpan;
+	if (Tracer::isEnabled() && dynamic_cast<const BuiltinRPNFunction *>(function) != nullptr) {
+		builtinSpan.emplace("builtin", function->getName());
+	}
 	RPNFunctionResult callResult;
 	if (functionToken->getType() == TokenType::TOKEN_TYPE_FUNCTION_CALL) {
 		callResult = function->call(arguments, functionName->getRange(), this->context);
@@ -360,20 +500,18 @@ ExpressionResult Interpreter::interpretFunctionCall(Token *functionToken) {
 	}
 	if (auto const *callExpressionResult = std::get_if<ExpressionResult>(&callResult);
 		(callExpressionResult != nullptr) && callExpressionResult->error()) {
+		for (Value *value : arguments) {
+			Value::deleteValue(&value, Value::INTERPRETER);
+		}
 		return *callExpressionResult;
 	}
 	Value *callReturnValue = std::get<Value *>(callResult);
-	if (!arguments.empty()) {
-		callReturnValue->setVariableRange(
-			TextRange::merge(functionName->getRange(), arguments.front()->getRange()));
-	} else {
-		callReturnValue->setVariableRange(functionName->getRange());
-	}
+	callReturnValue->setVariableRange(range);
 	for (Value *value : arguments) {
 		Value::deleteValue(&value, Value::INTERPRETER);
 	}
 
-	this->memory.push(callReturnValue);
+	this->memory.push(callReturnValue, range);
 	return {};
 }
 
@@ -431,6 +569,7 @@ ExpressionResult Interpreter::interpretFor(Line &line, CodeBlock &block) {
 
 	std::vector<Int *> forParams;
 	Value *param = nullptr;
+	const TextRange stepRange = this->memory.topRange();
 	for (int i = 0; i < 3; i++) {
 		param = this->memory.popVariableValue(this->context);
 		forParams.emplace(forParams.begin(), dynamic_cast<Int *>(param));
@@ -441,13 +580,13 @@ ExpressionResult Interpreter::interpretFor(Line &line, CodeBlock &block) {
 	CPPInterface const step{forParams.at(2)};
 	if (step == &zero) {
 		Value::deleteValue(&variable, Value::INTERPRETER);
-		return {"Step can't be 0", forParams.at(2)->getRange(), this->context};
+		return {"Step can't be 0", stepRange, this->context};
 	}
 
 	CPPInterface i{forParams.at(0)};
 	while (!result.breakingLoop() && !result.returnValue() &&
 		   ((step > &zero && i < forParams.at(1)) || (step < &zero && i > forParams.at(1)))) {
-		this->context->setValue(variable->getStringValue(), i.getValue());
+		this->context->setValue(variable, i.getValue());
 		result = this->interpret(block.getBlocks());
 		if (result.error()) {
 			return result;
@@ -485,7 +624,7 @@ ExpressionResult Interpreter::interpretTry(Line &line, CodeBlock &block) {
 	}
 
 	this->context->setValue(
-		line.top()->getStringValue(),
+		line.top(),
 		new String(result.getErrorMessage(), line.top()->getRange(), Value::CONTEXT_VARIABLE));
 
 	result = this->interpret(block.getNext()->getBlocks());
@@ -502,16 +641,17 @@ ExpressionResult Interpreter::interpretTry(Line &line, CodeBlock &block) {
 }
 
 ExpressionResult Interpreter::interpretList(const Token *keywordToken) {
+	const TextRange sizeRange = this->memory.topRange();
 	Int const *size = dynamic_cast<Int *>(this->memory.pop());
 	if (size->getValue() < 0) {
-		return {"List size must be positive", size->getRange(), this->context};
+		return {"List size must be positive", sizeRange, this->context};
 	}
-	TextRange range = keywordToken->getRange().merge(size->getRange());
+	TextRange range = keywordToken->getRange().merge(sizeRange);
 	std::vector<Value *> values;
 	Value *value = nullptr;
 	for (int i = 0; i < size->getValue(); i++) {
 		value = this->memory.popVariableValue(this->context);
-		if (value->getOwner() == Value::OBJECT_VALUE) {
+		if (value->getOwner() != Value::INTERPRETER) {
 			value = value->copy();
 		}
 		value->setOwner(Value::OBJECT_VALUE);
@@ -547,13 +687,14 @@ ExpressionResult Interpreter::interpretStruct(const Token *keywordToken) {
 }
 
 ExpressionResult Interpreter::interpretGet(const Token *keywordToken) {
+	const TextRange indexRange = this->memory.topRange();
 	Value *index = this->memory.popVariableValue(this->context);
 	int64_t const i = dynamic_cast<Int *>(index)->getValue();
 	List *list = dynamic_cast<List *>(this->memory.popVariableValue(this->context));
 	if (i < 0 || i >= list->size()) {
-		return {"Index out of range", index->getRange(), this->context};
+		return {"Index out of range", indexRange, this->context};
 	}
-	this->memory.push(new ListElement(list, i, keywordToken->getRange().merge(index->getRange()),
+	this->memory.push(new ListElement(list, i, keywordToken->getRange().merge(indexRange),
 									  Value::INTERPRETER));
 	Value::deleteValue(&index, Value::INTERPRETER);
 	return {};
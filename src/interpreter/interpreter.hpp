@@ -7,6 +7,8 @@
 #include <string>
 #include <vector>
 
+#include "cache/programcache.hpp"
+#include "textutilities/sourcefile.hpp"
 #include "textutilities/textutilities.hpp"
 
 #include "codeblocks/blockqueue.hpp"
@@ -25,8 +27,13 @@
 #include "context/context.hpp"
 #include "expressionresult/expressionresult.hpp"
 #include "lexer/lexer.hpp"
+#include "trace/phases.hpp"
+#include "trace/tracer.hpp"
 
 #include "interpreter/memory.hpp"
+#include "interpreter/profiler.hpp"
+#include "modules/importgraph.hpp"
+#include "modules/moduleimport.hpp"
 
 #include "rpnfunctions/builtinmap.hpp"
 #include "rpnfunctions/rpnfunction.hpp"
@@ -35,6 +42,8 @@ class Interpreter {
   public:
 	Interpreter();
 	explicit Interpreter(ContextPtr ctx);
+	Interpreter(const Interpreter &other) = delete;
+	Interpreter &operator=(const Interpreter &other) = delete;
 	~Interpreter();
 
 	void clearMemory();
@@ -44,6 +53,8 @@ class Interpreter {
 
 	Value *getLastValue() const;
 	Value *&getLastValue();
+	const std::vector<StructDefinition> &getStructDefinitions() const;
+	const std::vector<ModuleImport> &getImports() const;
 
   private:
 	void checkMemory();
@@ -51,6 +62,9 @@ class Interpreter {
 	ExpressionResult interpretBlock(Line &line, CodeBlock &block);
 	void interpretFString(const FStringToken *token);
 	ExpressionResult interpretOperator(const OperatorToken *operatorToken);
+	ExpressionResult checkVectorOperands(const Value *left, const Value *right,
+										 const TextRange &leftRange, const TextRange &rightRange,
+										 const OperatorToken *operatorToken) const;
 	ExpressionResult interpretKeyword(const Token *keywordToken);
 	ExpressionResult interpretValueType(const Token *typeToken);
 	void interpretAssignment(const Token *operatorToken);
@@ -67,4 +81,10 @@ class Interpreter {
 	Value *lastValue;
 	Memory memory;
 	ContextPtr context;
+	// what the last interpreted file defines and imports for the modules which depend on it
+	std::vector<StructDefinition> structDefinitions;
+	std::vector<ModuleImport> imports;
+
+	// the interpreters alive, the functions and the modules run in nested interpreters
+	static unsigned int instances;
 };
\ No newline at end of file
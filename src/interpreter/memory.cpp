@@ -6,7 +6,19 @@ Memory::~Memory() {
 }
 
 void Memory::push(Value *const &value) {
+	this->push(value, value->getRange());
+}
+
+/**
+ * @brief push a value with the range of the tokens which produced it, it is used for the errors
+ * about the value because the shared constant values have no range
+ *
+ * @param value the value to push
+ * @param range the range of the tokens which produced the value
+ */
+void Memory::push(Value *const &value, const TextRange &range) {
 	this->stack.push(value);
+	this->ranges.push(range);
 }
 
 Value *&Memory::pop() {
@@ -15,6 +27,7 @@ Value *&Memory::pop() {
 	}
 	Value *&value = this->stack.top();
 	this->stack.pop();
+	this->ranges.pop();
 	return value;
 }
 
@@ -23,13 +36,14 @@ Value *Memory::popVariableValue(const ContextPtr &context) {
 	Value *value = nullptr;
 	Value *name = this->stack.top();
 	this->stack.pop();
+	this->ranges.pop();
 	switch (name->getType()) {
 		case VARIABLE:
 			value = context->getValue(name);
 			break;
 		case BUILTIN_VARIABLE:
-			value = new Function(&builtins::builtinFunctions.at(name->getStringValue()),
-									name->getRange(), Value::INTERPRETER);
+			value = new Function(builtins::findSymbol(static_cast<Variable *>(name)->getSymbol()),
+								 name->getRange(), Value::INTERPRETER);
 			break;
 		case PATH:
 		case BUILTIN_PATH:
@@ -50,8 +64,14 @@ Value *Memory::popVariableValue(const ContextPtr &context) {
 	return value;
 }
 
-Value *&Memory::getStructureValue(Value *pathValue, const ContextPtr &context) {
+Value *Memory::getStructureValue(Value *pathValue, const ContextPtr &context) {
 	Path const *path = dynamic_cast<Path *>(pathValue);
+	if (this->stack.top()->getType() == LIST_ELEMENT) {
+		Value *element = this->pop();
+		Value *member = dynamic_cast<ListElement *>(element)->getMember(path);
+		Value::deleteValue(&element, Value::INTERPRETER);
+		return member;
+	}
 	if (this->stack.top()->getType() == VARIABLE) {
 		Value const *name = this->pop();
 		return dynamic_cast<Struct *>(Struct::getStruct(name, path, context))->getMember(path);
@@ -64,10 +84,15 @@ Value *&Memory::top() {
 	return this->stack.top();
 }
 
+TextRange Memory::topRange() const {
+	return this->ranges.top();
+}
+
 void Memory::clear(size_t offset) {
 	while (this->stack.size() > offset) {
 		Value::deleteValue(&this->stack.top(), Value::INTERPRETER);
 		this->stack.pop();
+		this->ranges.pop();
 	}
 }
 
@@ -94,9 +119,9 @@ ExpressionResult Memory::sizeExpected(size_t size, const std::string &message, T
 		return {message + " (Memory is empty)", range, ctx};
 	}
 	if (this->stack.size() < size) {
-		TextRange const firstRange = this->stack.top()->getRange();
+		TextRange const firstRange = this->ranges.top();
 		this->clear(1);
-		return {message, this->stack.top()->getRange().merge(firstRange), ctx};
+		return {message, TextRange::merge(this->ranges.top(), firstRange), ctx};
 	}
 	return {};
 }
@@ -12,9 +12,11 @@ class Memory {
 	~Memory();
 
 	void push(Value *const &value);
+	void push(Value *const &value, const TextRange &range);
 	Value *&pop();
 	Value *popVariableValue(const ContextPtr &context);
 	Value *&top();
+	TextRange topRange() const;
 	void clear(size_t offset = 0);
 	bool empty() const;
 	size_t size() const;
@@ -22,8 +24,10 @@ class Memory {
 								  const ContextPtr &ctx);
 
   private:
-	Value *&getStructureValue(Value *pathValue, const ContextPtr &context);
+	Value *getStructureValue(Value *pathValue, const ContextPtr &context);
 	std::stack<Value *> stack;
+	// the range of the tokens which pushed each value, the shared constant values have none
+	std::stack<TextRange> ranges;
 };
 
 #include "modules/module.hpp"
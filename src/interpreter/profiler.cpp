@@ -0,0 +1,477 @@
+#include "interpreter/profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sys/time.h>
+#include <vector>
+
+#include "value/types.hpp"
+#include "value/types/listelement.hpp"
+#include "value/types/struct.hpp"
+
+bool Profiler::running = false;
+bool Profiler::sampling = false;
+bool Profiler::trackingAllocations = false;
+bool Profiler::checkingLeaks = false;
+size_t Profiler::leakCount = 0;
+std::string Profiler::collapsedPath;
+double Profiler::cpuTime = 0;
+std::unordered_map<const void *, Profiler::Definition> Profiler::definitions;
+
+Profiler::StackFrame Profiler::stack[Profiler::maxDepth];
+TextRange Profiler::tokens[Profiler::maxDepth];
+volatile std::sig_atomic_t Profiler::depth = 0;
+std::unique_ptr<Profiler::StackFrame[]> Profiler::frames;
+std::unique_ptr<Profiler::Sample[]> Profiler::samples;
+uint32_t Profiler::frameCount = 0;
+uint32_t Profiler::sampleCount = 0;
+uint32_t Profiler::droppedSamples = 0;
+
+std::mutex Profiler::allocationsMutex;
+std::thread::id Profiler::interpreterThread;
+std::unordered_map<const Value *, Profiler::Allocation> Profiler::allocations;
+size_t Profiler::liveValues[NONE + 1] = {};
+size_t Profiler::peakValues[NONE + 1] = {};
+volatile std::sig_atomic_t Profiler::allocationReportRequested = 0;
+
+/**
+ * @brief push a frame on the profiled stack if the profiler runs
+ *
+ * @param code the file or the function, given to define
+ * @param line the line attributed to the frame until a line of its code runs
+ */
+Profiler::Frame::Frame(const void *code, unsigned long line) {
+	if (!Profiler::running || Profiler::depth == Profiler::maxDepth) {
+		return;
+	}
+	Profiler::stack[Profiler::depth] = {code, static_cast<uint32_t>(line)};
+	Profiler::tokens[Profiler::depth] = TextRange();
+	// the frame must be complete before the signal handler can see it
+	std::atomic_signal_fence(std::memory_order_release);
+	Profiler::depth = Profiler::depth + 1;
+	this->pushed = true;
+}
+
+Profiler::Frame::~Frame() {
+	if (this->pushed) {
+		Profiler::depth = Profiler::depth - 1;
+	}
+}
+
+/**
+ * @brief start sampling, the report is displayed and the collapsed stacks are written when the
+ * profiler stops, at the latest when the program exits
+ *
+ * @param collapsedPath the file to write the collapsed stacks in
+ * @return bool false if the timer couldn't be started
+ */
+bool Profiler::start(std::string_view collapsedPath) {
+	// the buffers are never initialized, their pages are only touched by the samples
+	Profiler::frames.reset(new StackFrame[Profiler::maxFrames]);
+	Profiler::samples.reset(new Sample[Profiler::maxSamples]);
+	Profiler::collapsedPath = collapsedPath;
+
+	struct sigaction action {};
+	action.sa_handler = &Profiler::sample;
+	action.sa_flags = SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	const itimerval timer{{0, Profiler::interval}, {0, Profiler::interval}};
+	if (sigaction(SIGPROF, &action, nullptr) != 0 || setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+		return false;
+	}
+	Profiler::running = true;
+	Profiler::sampling = true;
+	Profiler::cpuTime = Profiler::getCpuTime();
+	// the exit builtin doesn't return to main
+	std::atexit(&Profiler::stop);
+	return true;
+}
+
+/**
+ * @brief record the values alive, the values by line and the peak of each type are displayed when
+ * the profiler stops and each time the report signal is received
+ *
+ * @param reportSignal the signal requesting a report, 0 to only report at exit
+ * @return bool false if the signal handler couldn't be installed
+ */
+bool Profiler::trackAllocations(int reportSignal) {
+	if (reportSignal != 0) {
+		struct sigaction action {};
+		action.sa_handler = &Profiler::requestAllocationReport;
+		action.sa_flags = SA_RESTART;
+		sigemptyset(&action.sa_mask);
+		if (sigaction(reportSignal, &action, nullptr) != 0) {
+			return false;
+		}
+	}
+	Profiler::installAllocationHooks();
+	Profiler::trackingAllocations = true;
+	return true;
+}
+
+/**
+ * @brief report the temporary values which are still alive when the outermost interpreter clears
+ * its memory, they can't be deleted anymore
+ */
+void Profiler::checkLeaks() {
+	Profiler::installAllocationHooks();
+	Profiler::checkingLeaks = true;
+}
+
+/**
+ * @brief stop sampling, display the lines where the most time was spent on the error output and
+ * write the collapsed stacks
+ */
+void Profiler::stop() {
+	Profiler::running = false;
+	Profiler::checkingLeaks = false;
+	Value::onCreate = nullptr;
+	Value::onDestroy = nullptr;
+	if (Profiler::trackingAllocations) {
+		Profiler::trackingAllocations = false;
+		Profiler::printAllocations(std::cerr);
+	}
+	if (!Profiler::sampling) {
+		return;
+	}
+	Profiler::sampling = false;
+	const itimerval timer{};
+	setitimer(ITIMER_PROF, &timer, nullptr);
+	signal(SIGPROF, SIG_IGN);
+	Profiler::cpuTime = Profiler::getCpuTime() - Profiler::cpuTime;
+
+	Profiler::printReport(std::cerr);
+	std::ofstream file(Profiler::collapsedPath);
+	if (!file) {
+		std::cerr << "Can't write the profile in " << Profiler::collapsedPath << std::endl;
+		return;
+	}
+	Profiler::writeCollapsedStacks(file);
+}
+
+/**
+ * @brief give a name to a file or a function before it is run, the samples only keep a pointer to
+ * the code
+ *
+ * @param code the object identifying the code, it is used as the key of the frames
+ * @param name the name of the function or of the file
+ * @param filePath the file where the code is
+ */
+void Profiler::define(const void *code, std::string_view name, std::string_view filePath) {
+	if (Profiler::running) {
+		Profiler::definitions.insert_or_assign(
+			code, Definition{std::string(name), std::string(filePath)});
+	}
+}
+
+/**
+ * @brief SIGPROF handler, copy the current stack in the sample buffer. It must stay async signal
+ * safe: nothing is allocated and a sample which doesn't fit is only counted
+ *
+ * @param signal the signal number
+ */
+void Profiler::sample(int /*signal*/) {
+	const int savedErrno = errno;
+	const auto count = static_cast<uint32_t>(Profiler::depth);
+	if (Profiler::sampleCount == Profiler::maxSamples ||
+		Profiler::maxFrames - Profiler::frameCount < count) {
+		Profiler::droppedSamples++;
+	} else if (count > 0) {
+		std::copy_n(Profiler::stack, count, Profiler::frames.get() + Profiler::frameCount);
+		Profiler::samples[Profiler::sampleCount++] = {Profiler::frameCount, count};
+		Profiler::frameCount += count;
+	}
+	errno = savedErrno;
+}
+
+/**
+ * @brief the CPU time used by the process, the timer may be less precise than its interval so the
+ * report gives the real sampling rate
+ *
+ * @return double the CPU time in milliseconds
+ */
+double Profiler::getCpuTime() {
+	timespec time{};
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+	return static_cast<double>(time.tv_sec) * 1000 + static_cast<double>(time.tv_nsec) / 1e6;
+}
+
+void Profiler::printReport(std::ostream &stream) {
+	// samples of each line, attributed to the innermost frame only
+	std::map<std::pair<const void *, uint32_t>, uint32_t> lines;
+	for (uint32_t i = 0; i < Profiler::sampleCount; i++) {
+		const StackFrame &top =
+			Profiler::frames[Profiler::samples[i].offset + Profiler::samples[i].depth - 1];
+		lines[{top.code, top.line}]++;
+	}
+	std::vector<std::pair<std::string, uint32_t>> rows;
+	size_t width = 0;
+	for (const auto &[location, count] : lines) {
+		const Definition &definition = Profiler::definitions[location.first];
+		std::string label = definition.filePath + ":" +
+							(location.second == 0 ? "compile" : std::to_string(location.second));
+		// the code at the top level of a file is named after the file
+		if (definition.name != definition.filePath) {
+			label += " " + definition.name;
+		}
+		width = std::max(width, label.size());
+		rows.emplace_back(std::move(label), count);
+	}
+	std::ranges::stable_sort(rows, [](const auto &left, const auto &right) {
+		return left.second > right.second;
+	});
+
+	stream << std::fixed << std::setprecision(1);
+	stream << "Profile: " << Profiler::sampleCount << " samples in " << Profiler::cpuTime
+		   << " ms of CPU time";
+	if (Profiler::droppedSamples > 0) {
+		stream << ", " << Profiler::droppedSamples << " dropped";
+	}
+	stream << std::endl;
+	for (const auto &[label, count] : rows) {
+		stream << std::left << std::setw(static_cast<int>(width) + 2) << label << std::right
+			   << std::setw(8) << count << std::setw(7) << 100.0 * count / Profiler::sampleCount
+			   << "%" << std::endl;
+	}
+	stream << std::defaultfloat;
+}
+
+/**
+ * @brief write one line per distinct stack with its number of samples, the frames are separated by
+ * a semicolon from the outermost one
+ *
+ * @param stream the stream to write the stacks in
+ */
+void Profiler::writeCollapsedStacks(std::ostream &stream) {
+	std::map<std::string, uint32_t> stacks;
+	std::string line;
+	for (uint32_t i = 0; i < Profiler::sampleCount; i++) {
+		line.clear();
+		const Sample &sample = Profiler::samples[i];
+		for (uint32_t frame = 0; frame < sample.depth; frame++) {
+			if (frame != 0) {
+				line += ';';
+			}
+			line += Profiler::definitions[Profiler::frames[sample.offset + frame].code].name;
+		}
+		stacks[line]++;
+	}
+	for (const auto &[stack, count] : stacks) {
+		stream << stack << " " << count << "\n";
+	}
+}
+
+/**
+ * @brief display the leaked values, grouped by the line which created them and by their owner.
+ * While the program runs only the temporary values alive are leaked, once the contexts and the
+ * source files are released every value alive which is not shared is. The values are only
+ * reported once, they are not tracked anymore
+ *
+ * @param stream the stream to display the leaks in
+ * @param atExit if the program and its values were released
+ * @return size_t the number of leaked values found
+ */
+size_t Profiler::reportLeaks(std::ostream &stream, bool atExit) {
+	if (!Profiler::checkingLeaks) {
+		return 0;
+	}
+	constexpr std::string_view ownerNames[] = {"interpreter", "parent function",
+											   "context variable", "object value",
+											   "value token", "module",
+											   "empty value", "constant"};
+	std::lock_guard<std::mutex> const lock(Profiler::allocationsMutex);
+	std::map<std::tuple<std::string, uint32_t, Value::ValueOwner>, size_t> sites;
+	size_t leaks = 0;
+	for (auto it = Profiler::allocations.begin(); it != Profiler::allocations.end();) {
+		const Value::ValueOwner owner = it->first->getOwner();
+		const bool temporary = owner == Value::INTERPRETER || owner == Value::PARENT_FUNCTION;
+		// the constants and the empty values are shared instances which are never released
+		const bool shared = owner == Value::CONSTANT || owner == Value::EMPTY_VALUE;
+		if (atExit ? shared : !temporary) {
+			++it;
+			continue;
+		}
+		const Allocation &allocation = it->second;
+		const std::string file = allocation.code == nullptr
+									 ? "<tokenizer>"
+									 : Profiler::definitions[allocation.code].filePath;
+		sites[{file, static_cast<uint32_t>(allocation.range.line), owner}]++;
+		Profiler::liveValues[allocation.type]--;
+		it = Profiler::allocations.erase(it);
+		leaks++;
+	}
+	if (leaks == 0) {
+		return 0;
+	}
+	stream << "Leaked values: " << leaks << std::endl;
+	for (const auto &[site, count] : sites) {
+		const auto &[file, line, owner] = site;
+		stream << "  " << file << ":" << line << " owned by " << ownerNames[owner] << ": " << count
+			   << std::endl;
+	}
+	Profiler::leakCount += leaks;
+	return leaks;
+}
+
+/**
+ * @brief the number of leaked values reported since the leak check started
+ *
+ * @return size_t the number of values
+ */
+size_t Profiler::getLeakCount() {
+	return Profiler::leakCount;
+}
+
+void Profiler::installAllocationHooks() {
+	if (Value::onCreate == nullptr) {
+		Profiler::interpreterThread = std::this_thread::get_id();
+		Value::onCreate = &Profiler::valueCreated;
+		Value::onDestroy = &Profiler::valueDestroyed;
+		Profiler::running = true;
+		std::atexit(&Profiler::stop);
+	}
+}
+
+/**
+ * @brief attribute a new value to the code and the token running on the interpreter thread. The
+ * values created by the tokenizer on the thread pool have no code, they and the values created
+ * before the first token of a frame, while it is lexed, keep their own range
+ *
+ * @param value the value being constructed, only its base is initialized
+ */
+void Profiler::valueCreated(const Value *value) {
+	const void *code = nullptr;
+	TextRange range = value->getRange();
+	if (std::this_thread::get_id() == Profiler::interpreterThread && Profiler::depth > 0) {
+		code = Profiler::stack[Profiler::depth - 1].code;
+		if (!Profiler::tokens[Profiler::depth - 1].isEmpty()) {
+			range = Profiler::tokens[Profiler::depth - 1];
+		}
+	}
+	const ValueType type = value->getType();
+	std::lock_guard<std::mutex> const lock(Profiler::allocationsMutex);
+	Profiler::allocations.insert_or_assign(value, Allocation{code, range, type});
+	Profiler::peakValues[type] = std::max(Profiler::peakValues[type], ++Profiler::liveValues[type]);
+}
+
+void Profiler::valueDestroyed(const Value *value) {
+	std::lock_guard<std::mutex> const lock(Profiler::allocationsMutex);
+	auto it = Profiler::allocations.find(value);
+	if (it == Profiler::allocations.end()) {
+		return;
+	}
+	Profiler::liveValues[it->second.type]--;
+	Profiler::allocations.erase(it);
+}
+
+void Profiler::requestAllocationReport(int /*signal*/) {
+	Profiler::allocationReportRequested = 1;
+}
+
+void Profiler::reportAllocations() {
+	Profiler::allocationReportRequested = 0;
+	Profiler::printAllocations(std::cerr);
+}
+
+/**
+ * @brief display the lines which hold the most memory with the values they created which are still
+ * alive, then the number of values of each type alive and at the peak
+ *
+ * @param stream the stream to display the report in
+ */
+void Profiler::printAllocations(std::ostream &stream) {
+	struct Usage {
+		size_t values = 0;
+		size_t bytes = 0;
+	};
+	std::lock_guard<std::mutex> const lock(Profiler::allocationsMutex);
+	std::map<std::pair<const void *, uint32_t>, Usage> lines;
+	size_t totalBytes = 0;
+	for (const auto &[value, allocation] : Profiler::allocations) {
+		Usage &usage = lines[{allocation.code, static_cast<uint32_t>(allocation.range.line)}];
+		const size_t size = Profiler::valueSize(value);
+		usage.values++;
+		usage.bytes += size;
+		totalBytes += size;
+	}
+
+	std::vector<std::pair<std::string, Usage>> rows;
+	size_t width = 0;
+	for (const auto &[location, usage] : lines) {
+		std::string label = "<tokenizer>:" + std::to_string(location.second);
+		if (location.first != nullptr) {
+			const Definition &definition = Profiler::definitions[location.first];
+			label = definition.filePath + ":" + std::to_string(location.second);
+		}
+		width = std::max(width, label.size());
+		rows.emplace_back(std::move(label), usage);
+	}
+	std::ranges::stable_sort(rows, [](const auto &left, const auto &right) {
+		return left.second.bytes > right.second.bytes;
+	});
+
+	stream << "Live values: " << Profiler::allocations.size() << ", " << totalBytes << " bytes"
+		   << std::endl;
+	for (size_t i = 0; i < rows.size() && i < Profiler::allocationReportLines; i++) {
+		stream << std::left << std::setw(static_cast<int>(width) + 2) << rows[i].first << std::right
+			   << std::setw(10) << rows[i].second.values << " values" << std::setw(12)
+			   << rows[i].second.bytes << " bytes" << std::endl;
+	}
+	if (rows.size() > Profiler::allocationReportLines) {
+		stream << "... " << rows.size() - Profiler::allocationReportLines << " more lines"
+			   << std::endl;
+	}
+	stream << "Values by type (live, peak):" << std::endl;
+	for (size_t type = 0; type <= NONE; type++) {
+		if (Profiler::peakValues[type] == 0) {
+			continue;
+		}
+		stream << std::left << std::setw(18) << stringType(static_cast<ValueType>(type))
+			   << std::right << std::setw(10) << Profiler::liveValues[type] << std::setw(10)
+			   << Profiler::peakValues[type] << std::endl;
+	}
+}
+
+/**
+ * @brief estimate the memory used by a value: the object and the storage it owns directly. The
+ * elements of a list are values of their own, only the pointers to them are counted
+ *
+ * @param value the value to measure
+ * @return size_t the size in bytes
+ */
+size_t Profiler::valueSize(const Value *value) {
+	switch (value->getType()) {
+		case INT:
+			return sizeof(Int);
+		case FLOAT:
+			return sizeof(Float);
+		case BOOL:
+			return sizeof(Bool);
+		case STRING:
+			return sizeof(String) + value->getStringValue().size();
+		case LIST:
+			return sizeof(List) + static_cast<const List *>(value)->size() * sizeof(Value *);
+		case STRUCT:
+			return sizeof(Struct);
+		case FUNCTION:
+			return sizeof(Function);
+		case VARIABLE:
+		case BUILTIN_VARIABLE:
+			return sizeof(Variable);
+		case PATH:
+		case BUILTIN_PATH:
+		case STRUCT_ACCESS:
+			return sizeof(Path);
+		case LIST_ELEMENT:
+			return sizeof(ListElement);
+		default:
+			return sizeof(None);
+	}
+}
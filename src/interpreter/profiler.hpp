@@ -0,0 +1,138 @@
+#pragma once
+
+#include <csignal>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#include "value/value.hpp"
+
+/**
+ * @brief sampling profiler of the RPN code. The interpreter keeps a stack of the files and the
+ * functions being run with their current line, a SIGPROF timer copies it in a preallocated buffer
+ * at a fixed rate of CPU time. The samples are only aggregated when the profiler stops, into a per
+ * line report and a collapsed stack file for the flame graph tools.
+ * The profiler can also track the values alive, each one is attributed to the file of the code
+ * creating it and to the line of the token being interpreted. The same tracking finds the values
+ * which are never deleted
+ */
+class Profiler {
+  public:
+	/**
+	 * @brief push a file or a function on the profiled stack for the lifetime of the frame, the
+	 * code must have been defined before
+	 */
+	class Frame {
+	  public:
+		Frame(const void *code, unsigned long line);
+		Frame(const Frame &other) = delete;
+		Frame &operator=(const Frame &other) = delete;
+		~Frame();
+
+	  private:
+		bool pushed = false;
+	};
+
+	static bool start(std::string_view collapsedPath);
+	static bool trackAllocations(int reportSignal);
+	static void checkLeaks();
+	static void stop();
+
+	static size_t reportLeaks(std::ostream &stream, bool atExit = false);
+	static size_t getLeakCount();
+
+	static void define(const void *code, std::string_view name, std::string_view filePath);
+
+	static bool isRunning() {
+		return Profiler::running;
+	}
+
+	/**
+	 * @brief set the token interpreted by the frame on top of the stack, the samples use its line
+	 * and the values created are attributed to it
+	 */
+	static void setToken(const TextRange &range) {
+		if (Profiler::depth > 0) {
+			Profiler::stack[Profiler::depth - 1].line = static_cast<uint32_t>(range.line);
+			Profiler::tokens[Profiler::depth - 1] = range;
+		}
+		// the report can't be written from the signal handler
+		if (Profiler::allocationReportRequested != 0) {
+			Profiler::reportAllocations();
+		}
+	}
+
+  private:
+	struct StackFrame {
+		const void *code;
+		uint32_t line;
+	};
+
+	struct Sample {
+		uint32_t offset;
+		uint32_t depth;
+	};
+
+	struct Definition {
+		std::string name;
+		std::string filePath;
+	};
+
+	struct Allocation {
+		const void *code;
+		TextRange range;
+		ValueType type;
+	};
+
+	static void sample(int signal);
+	static double getCpuTime();
+	static void printReport(std::ostream &stream);
+	static void writeCollapsedStacks(std::ostream &stream);
+	static void installAllocationHooks();
+	static void valueCreated(const Value *value);
+	static void valueDestroyed(const Value *value);
+	static void requestAllocationReport(int signal);
+	static void reportAllocations();
+	static void printAllocations(std::ostream &stream);
+	static size_t valueSize(const Value *value);
+
+	static constexpr int interval = 1000; // microseconds of CPU time between two samples
+	static constexpr uint32_t maxDepth = 1024;
+	static constexpr uint32_t maxSamples = 1 << 18;
+	static constexpr uint32_t maxFrames = 1 << 20;
+	static constexpr size_t allocationReportLines = 20;
+
+	// the frames are kept when the samples or the allocations are recorded
+	static bool running;
+	static bool sampling;
+	static bool trackingAllocations;
+	static bool checkingLeaks;
+	static size_t leakCount;
+	static std::string collapsedPath;
+	static double cpuTime;
+	static std::unordered_map<const void *, Definition> definitions;
+
+	// shared with the signal handler, which runs on the interpreter thread
+	static StackFrame stack[maxDepth];
+	// the token interpreted by each frame, it is not read by the signal handler
+	static TextRange tokens[maxDepth];
+	static volatile std::sig_atomic_t depth;
+	static std::unique_ptr<StackFrame[]> frames;
+	static std::unique_ptr<Sample[]> samples;
+	static uint32_t frameCount;
+	static uint32_t sampleCount;
+	static uint32_t droppedSamples;
+
+	// the values of the tokens are created on the thread pool when a file is lexed
+	static std::mutex allocationsMutex;
+	static std::thread::id interpreterThread;
+	static std::unordered_map<const Value *, Allocation> allocations;
+	static size_t liveValues[NONE + 1];
+	static size_t peakValues[NONE + 1];
+	static volatile std::sig_atomic_t allocationReportRequested;
+};
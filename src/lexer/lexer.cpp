@@ -1,11 +1,43 @@
 #include "lexer/lexer.hpp"
 
-Lexer::Lexer(const std::deque<Token *> &tokens, ContextPtr context)
-	: context(context), tokens(tokens) {}
+#include "trace/phases.hpp"
+#include "trace/tracer.hpp"
 
-Lexer::~Lexer() {
-	delete this->currentLine;
+namespace {
+// number of lines tokenized by a task of the thread pool
+constexpr size_t chunkLines = 4096;
+
+/**
+ * @brief the tokens of a chunk of lines, they are released with the chunk once they are lexed
+ */
+struct TokenizedChunk {
+	Arena arena;
+	std::deque<Token *> tokens;
+	ExpressionResult result;
+};
+
+std::unique_ptr<TokenizedChunk> tokenizeChunk(const std::vector<std::string_view> &lines,
+											  size_t start, size_t end, const ContextPtr &context) {
+	const Tracer::Span span("compile", "tokenize");
+	const Phases::Scope phase("tokenize", context->getName());
+	auto chunk = std::make_unique<TokenizedChunk>();
+	for (size_t i = start; i < end; i++) {
+		const auto line = static_cast<unsigned int>(i + 1);
+		chunk->result = Lexer::tokenize(line, lines[i], chunk->tokens, chunk->arena, context);
+		if (chunk->result.error()) {
+			break;
+		}
+		chunk->tokens.push_back(chunk->arena.create<StringToken>(
+			line, lines[i].size(), TokenType::TOKEN_TYPE_END_OF_LINE, "\n"));
+	}
+	return chunk;
 }
+} // namespace
+
+Lexer::Lexer(const std::deque<Token *> &tokens, Arena &arena, ContextPtr context,
+			 Analyzer *analyzer)
+	: context(context), arena(arena), currentLine(arena.create<Line>(arena)), analyzer(analyzer),
+	  tokens(tokens) {}
 
 /**
  * @brief append current line to the current code block if there is one or to the global code queue
@@ -15,13 +47,14 @@ void Lexer::pushLine() {
 	if (this->currentLine->empty()) {
 		return;
 	}
+	Line *line = this->arena.create<Line>(this->arena, *this->currentLine);
 	if (!this->keywordBlockStack.empty()) {
-		this->keywordBlockStack.top()->push(this->currentLine);
+		this->keywordBlockStack.top()->push(line);
 	} else {
-		this->codeBlocks.push(this->currentLine);
+		this->codeBlocks.push(line);
 	}
 
-	this->currentLine = new Line();
+	this->currentLine->clear();
 }
 
 bool Lexer::hasParentKeywordBlock(const std::vector<KeywordEnum> &keywords) const {
@@ -43,18 +76,123 @@ BlockQueue &Lexer::getBlocks() {
 	return this->codeBlocks;
 }
 
+const std::vector<StructDefinition> &Lexer::getStructDefinitions() const {
+	return this->structDefinitions;
+}
+
 /**
  * @brief lexes the given tokens
  *
+ * @param analyze run the analyzer on the blocks once they are lexed
+ * @return ExpressionResult if the lexing was successful, otherwise an error
+ */
+ExpressionResult Lexer::lex(bool analyze) {
+	if (ExpressionResult result = this->lexTokens(); result.error()) {
+		return result;
+	}
+
+	if (!this->keywordBlockStack.empty()) {
+		return {"Missing closing keyword for block " +
+					this->keywordBlockStack.top()->getKeywordToken()->getStringValue(),
+				this->lastTokenRange, this->context};
+	}
+
+	this->pushLine();
+	return analyze ? this->analyze() : ExpressionResult();
+};
+
+/**
+ * @brief analyze the lexed blocks, with the analyzer given to the lexer if there is one
+ *
+ * @return ExpressionResult the first error found by the analyzer
+ */
+ExpressionResult Lexer::analyze() {
+	std::optional<Analyzer> ownAnalyzer;
+	Analyzer &analyzer =
+		this->analyzer != nullptr ? *this->analyzer : ownAnalyzer.emplace(this->context);
+	const Phases::Scope phase("analyze", this->context->getName());
+	analyzer.analyze(this->codeBlocks, true);
+	return analyzer.analyzeErrors();
+}
+
+/**
+ * @brief lexes the next tokens of the compilation unit without finishing it, the tokens are
+ * not referenced once the function returns so they can be released. The tokens must end with a
+ * complete line
+ *
+ * @param tokens the next tokens
+ * @return ExpressionResult if the lexing was successful, otherwise an error
+ */
+ExpressionResult Lexer::feed(std::deque<Token *> tokens) {
+	this->tokens = std::move(tokens);
+	return this->lexTokens();
+}
+
+/**
+ * @brief tokenize and lex all the lines of a compilation unit. The lines are tokenized by chunks on
+ * the thread pool and the chunks are lexed in order as soon as they are ready, only a few chunks
+ * are in memory at the same time. The error of the first chunk which fails is returned so the
+ * first error in the source is reported
+ *
+ * @param lines the lines of the compilation unit, they must outlive the call
+ * @param pool the pool which tokenizes the chunks
+ * @param analyze run the analyzer on the blocks once they are lexed
+ * @return ExpressionResult if the lexing was successful, otherwise an error
+ */
+ExpressionResult Lexer::lexLines(const std::vector<std::string_view> &lines, ThreadPool &pool,
+								 bool analyze) {
+	const size_t chunkCount = (lines.size() + chunkLines - 1) / chunkLines;
+	if (chunkCount <= 1) {
+		std::unique_ptr<TokenizedChunk> chunk =
+			tokenizeChunk(lines, 0, lines.size(), this->context);
+		if (chunk->result.error()) {
+			return chunk->result;
+		}
+		if (ExpressionResult result = this->feed(std::move(chunk->tokens)); result.error()) {
+			return result;
+		}
+		return this->lex(analyze);
+	}
+
+	const size_t window = std::max<size_t>(2, pool.size() * 2);
+	std::deque<std::future<std::unique_ptr<TokenizedChunk>>> pending;
+	size_t submitted = 0;
+	ExpressionResult result;
+	for (size_t i = 0; i < chunkCount && !result.error(); i++) {
+		for (; submitted < chunkCount && submitted < i + window; submitted++) {
+			const size_t start = submitted * chunkLines;
+			const size_t end = std::min(start + chunkLines, lines.size());
+			pending.push_back(pool.submit([&lines, start, end, context = this->context]() {
+				return tokenizeChunk(lines, start, end, context);
+			}));
+		}
+		std::unique_ptr<TokenizedChunk> chunk = pending.front().get();
+		pending.pop_front();
+		result = chunk->result.error() ? chunk->result : this->feed(std::move(chunk->tokens));
+	}
+	// the tasks reference the lines, they must be finished before returning
+	for (const auto &future : pending) {
+		future.wait();
+	}
+	if (result.error()) {
+		return result;
+	}
+	return this->lex(analyze);
+}
+
+/**
+ * @brief convert the pending tokens to lines and blocks
+ *
  * @return ExpressionResult if the lexing was successful, otherwise an error
  */
-ExpressionResult Lexer::lex() {
+ExpressionResult Lexer::lexTokens() {
+	const Phases::Scope phase("lex", this->context->getName());
 	Token *token = nullptr;
 	ExpressionResult result;
 	while (!this->tokens.empty()) {
 		token = this->tokens.front();
 		this->tokens.pop_front();
-		this->integrated = false;
+		this->lastTokenRange = token->getRange();
 		switch (token->getType()) {
 			case TokenType::TOKEN_TYPE_END_OF_LINE:
 			case TokenType::TOKEN_TYPE_EXPRESSION_SEPARATOR:
@@ -76,16 +214,14 @@ ExpressionResult Lexer::lex() {
 				result = this->parseHexNumber(token);
 				break;
 			case TokenType::TOKEN_TYPE_INT:
-				this->currentLine->push(new ValueToken(new Int(
-					std::stoi(token->getStringValue()), token->getRange(), Value::VALUE_TOKEN)));
+				result = this->parseInt(token);
 				break;
 			case TokenType::TOKEN_TYPE_FLOAT:
-				this->currentLine->push(new ValueToken(new Float(
-					std::stof(token->getStringValue()), token->getRange(), Value::VALUE_TOKEN)));
+				result = this->parseFloat(token);
 				break;
 			case TokenType::TOKEN_TYPE_BOOL:
-				this->currentLine->push(new ValueToken(new Bool(
-					token->getStringValue() == "true", token->getRange(), Value::VALUE_TOKEN)));
+				this->currentLine->push(this->arena.create<ValueToken>(
+					new Bool(text(token) == "true", token->getRange(), Value::VALUE_TOKEN)));
 				break;
 			case TokenType::TOKEN_TYPE_COLON:
 				result = this->parseFunctionCall(token);
@@ -101,33 +237,74 @@ ExpressionResult Lexer::lex() {
 				break;
 			case TokenType::TOKEN_TYPE_OPERATOR:
 			case TokenType::TOKEN_TYPE_BOOLEAN_OPERATOR:
-				this->currentLine->push(new OperatorToken(token->getRange(), token->getType(),
-														  token->getStringValue()));
+				this->currentLine->push(this->arena.create<OperatorToken>(
+					token->getRange(), token->getType(), text(token)));
 				break;
 			default:
-				this->integrated = true;
-				this->currentLine->push(token);
+				this->currentLine->push(this->adopt(token));
 				break;
 		}
 		if (result.error()) {
 			return result;
 		}
-		if (!this->integrated) {
-			delete token;
-		}
 	}
+	return result;
+}
 
-	if (!this->keywordBlockStack.empty()) {
-		return {"Missing closing keyword for block " +
-					this->keywordBlockStack.top()->getKeywordToken()->getStringValue(),
-				token->getRange(), this->context};
+/**
+ * @brief get the text of a token produced by Lexer::tokenize without copying it
+ *
+ * @param token a token produced by the tokenizer, they are all string tokens
+ * @return std::string_view the text of the token in the source
+ */
+std::string_view Lexer::text(Token const *token) {
+	return static_cast<StringToken const *>(token)->getValue();
+}
+
+/**
+ * @brief copy a token produced by Lexer::tokenize in the arena of the compilation unit so it can
+ * be kept in a line
+ *
+ * @param token a token produced by the tokenizer
+ * @return Token* the copy of the token
+ */
+Token *Lexer::adopt(Token const *token) {
+	return this->arena.create<StringToken>(*static_cast<StringToken const *>(token));
+}
+
+/**
+ * @brief convert an int token to a value token and push it to the current line
+ *
+ * @param token the token to convert
+ * @return ExpressionResult if the conversion was successful, otherwise an error
+ */
+ExpressionResult Lexer::parseInt(Token const *token) {
+	std::string_view const value = text(token);
+	int64_t number = 0;
+	if (std::from_chars(value.data(), value.data() + value.size(), number).ec != std::errc()) {
+		return {"Integer out of range", token->getRange(), this->context};
 	}
+	this->currentLine->push(
+		this->arena.create<ValueToken>(new Int(number, token->getRange(), Value::VALUE_TOKEN)));
+	return {};
+}
 
-	this->pushLine();
-	Analyzer analyzer(this->context);
-	analyzer.analyze(this->codeBlocks, true);
-	return analyzer.analyzeErrors();
-};
+/**
+ * @brief convert a float token to a value token and push it to the current line
+ *
+ * @param token the token to convert
+ * @return ExpressionResult if the conversion was successful, otherwise an error
+ */
+ExpressionResult Lexer::parseFloat(Token const *token) {
+	std::string_view const value = text(token);
+	float number = 0;
+	if (std::from_chars(value.data(), value.data() + value.size(), number).ec != std::errc()) {
+		return {"Invalid float " + std::string(value), token->getRange(), this->context};
+	}
+	this->currentLine->push(
+		this->arena.create<ValueToken>(new Float(number, token->getRange(), Value::VALUE_TOKEN)));
+	return {};
+}
 
 /**
  * @brief convert bin number token to base 10 number token and push it to the current line
@@ -136,7 +313,7 @@ ExpressionResult Lexer::lex() {
  * @return ExpressionResult if the conversion was successful, otherwise an error
  */
 ExpressionResult Lexer::parseBinNumber(Token const *token) {
-	const std::string value = token->getStringValue();
+	std::string_view const value = text(token);
 	int64_t number = 0;
 	for (char const c : value) {
 		if (c == 0 && number == 0) {
@@ -145,7 +322,8 @@ ExpressionResult Lexer::parseBinNumber(Token const *token) {
 		number <<= 1;
 		number |= static_cast<long>(c == '1');
 	}
-	this->currentLine->push(new ValueToken(new Int(number, token->getRange(), Value::VALUE_TOKEN)));
+	this->currentLine->push(
+		this->arena.create<ValueToken>(new Int(number, token->getRange(), Value::VALUE_TOKEN)));
 	return {};
 }
 
@@ -156,7 +334,7 @@ ExpressionResult Lexer::parseBinNumber(Token const *token) {
  * @return ExpressionResult the converted token
  */
 ExpressionResult Lexer::parseHexNumber(Token const *token) {
-	const std::string value = token->getStringValue();
+	std::string_view const value = text(token);
 	int64_t number = 0;
 	for (char const c : value) {
 		number <<= 4;
@@ -168,12 +346,13 @@ ExpressionResult Lexer::parseHexNumber(Token const *token) {
 			number |= c - 'A' + 10;
 		}
 	}
-	this->currentLine->push(new ValueToken(new Int(number, token->getRange(), Value::VALUE_TOKEN)));
+	this->currentLine->push(
+		this->arena.create<ValueToken>(new Int(number, token->getRange(), Value::VALUE_TOKEN)));
 	return {};
 }
 
 ExpressionResult Lexer::parseFString(Token const *token) {
-	const std::string value = escapeCharacters(std::string(token->getStringValue()));
+	const std::string value = escapeCharacters(text(token));
 
 	std::vector<std::string> parts;
 	parts.emplace_back("");
@@ -199,7 +378,7 @@ ExpressionResult Lexer::parseFString(Token const *token) {
 		it++;
 	}
 
-	this->currentLine->push(new FStringToken(token->getRange(), parts));
+	this->currentLine->push(this->arena.create<FStringToken>(token->getRange(), parts));
 
 	return {};
 }
@@ -211,8 +390,8 @@ ExpressionResult Lexer::parseFString(Token const *token) {
  * @return ExpressionResult
  */
 ExpressionResult Lexer::parseString(Token const *token) {
-	this->currentLine->push(new ValueToken(new String(escapeCharacters(token->getStringValue()),
-													  token->getRange(), Value::VALUE_TOKEN)));
+	this->currentLine->push(this->arena.create<ValueToken>(
+		new String(escapeCharacters(text(token)), token->getRange(), Value::VALUE_TOKEN)));
 	return {};
 }
 
@@ -223,14 +402,9 @@ ExpressionResult Lexer::parseString(Token const *token) {
  * @return ExpressionResult if the conversion was successful, otherwise an error
  */
 ExpressionResult Lexer::parseLiteral(Token *token) {
-	if (keywordsRegex(token->getStringValue())) {
-		token = new KeywordToken(token->getRange(), token->getStringValue());
-		ExpressionResult result = this->parseKeyword(token);
-		if (!this->integrated) {
-			delete token;
-		}
-		this->integrated = false;
-		return result;
+	if (auto keyword = KeywordToken::findKeyword(text(token))) {
+		return this->parseKeyword(
+			this->arena.create<KeywordToken>(token->getRange(), keyword.value()));
 	}
 
 	if (!this->tokens.empty()) {
@@ -240,8 +414,8 @@ ExpressionResult Lexer::parseLiteral(Token *token) {
 		}
 	}
 
-	this->currentLine->push(new ValueToken(new Variable(token->getStringValue(), token->getRange()),
-										   TokenType::TOKEN_TYPE_LITERAL));
+	this->currentLine->push(this->arena.create<ValueToken>(
+		new Variable(text(token), token->getRange()), TokenType::TOKEN_TYPE_LITERAL));
 	return {};
 }
 
@@ -255,7 +429,6 @@ ExpressionResult Lexer::parsePath(Token const *token) {
 	std::vector<std::string> path{token->getStringValue()};
 	TextRange range = token->getRange();
 	while (!this->tokens.empty() && this->tokens.front()->getType() == TokenType::TOKEN_TYPE_DOT) {
-		delete this->tokens.front();
 		this->tokens.pop_front();
 		if (this->tokens.empty() ||
 			this->tokens.front()->getType() != TokenType::TOKEN_TYPE_LITERAL) {
@@ -263,10 +436,10 @@ ExpressionResult Lexer::parsePath(Token const *token) {
 		}
 		path.push_back(this->tokens.front()->getStringValue());
 		range.merge(this->tokens.front()->getRange());
-		delete this->tokens.front();
 		this->tokens.pop_front();
 	}
-	this->currentLine->push(new ValueToken(new Path(path, range), TokenType::TOKEN_TYPE_PATH));
+	this->currentLine->push(
+		this->arena.create<ValueToken>(new Path(path, range), TokenType::TOKEN_TYPE_PATH));
 	return {};
 }
 
@@ -285,8 +458,7 @@ ExpressionResult Lexer::parseStructAccess(Token *token) {
 	}
 	if (this->tokens.front()->getType() == TokenType::TOKEN_TYPE_VALUE_TYPE ||
 		this->tokens.front()->getType() == TokenType::TOKEN_TYPE_STRUCT_NAME) {
-		this->integrated = true;
-		this->currentLine->push(token);
+		this->currentLine->push(this->adopt(token));
 		return {};
 	}
 	if (this->tokens.front()->getType() != TokenType::TOKEN_TYPE_LITERAL) {
@@ -294,13 +466,11 @@ ExpressionResult Lexer::parseStructAccess(Token *token) {
 				this->context};
 	}
 	path.push_back(this->tokens.front()->getStringValue());
-	delete this->tokens.front();
 	this->tokens.pop_front();
 	TextRange arrowRange = token->getRange();
 	while (!this->tokens.empty() &&
 		   this->tokens.front()->getType() == TokenType::TOKEN_TYPE_ARROW) {
 		arrowRange = this->tokens.front()->getRange();
-		delete this->tokens.front();
 		this->tokens.pop_front();
 		if (this->tokens.empty() ||
 			this->tokens.front()->getType() != TokenType::TOKEN_TYPE_LITERAL) {
@@ -309,12 +479,11 @@ ExpressionResult Lexer::parseStructAccess(Token *token) {
 		}
 		path.push_back(this->tokens.front()->getStringValue());
 		range.merge(this->tokens.front()->getRange());
-		delete this->tokens.front();
 		this->tokens.pop_front();
 	}
 
-	this->currentLine->push(
-		new ValueToken(new Path(path, range, STRUCT_ACCESS), TokenType::TOKEN_TYPE_STRUCT_ACCESS));
+	this->currentLine->push(this->arena.create<ValueToken>(new Path(path, range, STRUCT_ACCESS),
+														   TokenType::TOKEN_TYPE_STRUCT_ACCESS));
 	return {};
 }
 
@@ -351,9 +520,7 @@ ExpressionResult Lexer::parseKeyword(Token *token) {
 			}
 			block = function;
 		} else if (name == KEYWORD_STRUCT) {
-			ExpressionResult result = this->parseStruct(dynamic_cast<CodeBlock *>(block));
-			delete block;
-			return result;
+			return this->parseStruct(dynamic_cast<CodeBlock *>(block));
 		}
 
 		if (!this->keywordBlockStack.empty()) {
@@ -378,8 +545,8 @@ ExpressionResult Lexer::parseKeyword(Token *token) {
 			this->keywordBlockStack.top()->getKeyword() == KEYWORD_STRUCT) {
 			return {"Structs cannot contain other blocks", token->getRange(), this->context};
 		}
-		this->keywordBlockStack.push(new CodeBlock(dynamic_cast<KeywordToken *>(token)));
-		this->integrated = true;
+		this->keywordBlockStack.push(
+			this->arena.create<CodeBlock>(dynamic_cast<KeywordToken *>(token)));
 		return {};
 	}
 
@@ -399,7 +566,6 @@ ExpressionResult Lexer::parseKeyword(Token *token) {
 			return this->parseFunctionSignature(token);
 		} else {
 			this->currentLine->push(token);
-			this->integrated = true;
 		}
 	}
 
@@ -424,7 +590,6 @@ ExpressionResult Lexer::parseFunctionCall(Token const *token) {
 	this->tokens.pop_front();
 	TextRange const literalRange = literal->getRange();
 	ExpressionResult result = this->parseLiteral(literal);
-	delete literal;
 	if (result.error()) {
 		return result;
 	}
@@ -457,7 +622,7 @@ std::pair<ExpressionResult, FunctionBlock *> Lexer::parseFunction(CodeBlock *blo
 							  nullptr);
 	}
 
-	std::unique_ptr<Line> line{dynamic_cast<Line *>(this->codeBlocks.popBack())};
+	Line *line = dynamic_cast<Line *>(this->codeBlocks.popBack());
 	if (line->size() < 3) {
 		return std::make_pair(
 			ExpressionResult("Expected function name and return type before fun keyword",
@@ -513,12 +678,13 @@ std::pair<ExpressionResult, FunctionBlock *> Lexer::parseFunction(CodeBlock *blo
 	if (line->top()->getType() == TokenType::TOKEN_TYPE_VALUE_TYPE) {
 		return std::make_pair(
 			ExpressionResult(),
-			new FunctionBlock(name, types, dynamic_cast<TypeToken *>(line->pop())->getValueType(),
-							  block));
+			this->arena.create<FunctionBlock>(
+				name, types, dynamic_cast<TypeToken *>(line->pop())->getValueType(), block));
 	}
 	if (line->top()->getType() == TokenType::TOKEN_TYPE_STRUCT_NAME) {
 		return std::make_pair(ExpressionResult(),
-							  new FunctionBlock(name, types, line->pop()->getStringValue(), block));
+							  this->arena.create<FunctionBlock>(
+								  name, types, line->pop()->getStringValue(), block));
 	}
 
 	return std::make_pair(ExpressionResult("Return type expected after '->' token but got" +
@@ -577,7 +743,7 @@ ExpressionResult Lexer::parseFunctionSignature(Token *token) {
 		return {"Unexpected token after function signature", this->currentLine->top()->getRange(),
 				this->context};
 	}
-	this->codeBlocks.push(new FunctionSignatureLine(
+	this->codeBlocks.push(this->arena.create<FunctionSignatureLine>(
 		FunctionSignature{types, returnType, false, false}, name, token->getRange()));
 	return {};
 }
@@ -599,7 +765,7 @@ ExpressionResult Lexer::parseStruct(CodeBlock *block) {
 	if (this->codeBlocks.empty()) {
 		return {"Exepcted struct name before struct block", block->getRange(), this->context};
 	}
-	std::unique_ptr<Line> line{dynamic_cast<Line *>(this->codeBlocks.popBack())};
+	Line *line = dynamic_cast<Line *>(this->codeBlocks.popBack());
 	if (line->empty()) {
 		return {"Expected struct name before struct block", block->getRange(), this->context};
 	}
@@ -638,11 +804,13 @@ ExpressionResult Lexer::parseStruct(CodeBlock *block) {
 					  dynamic_cast<TypeToken *>(l->pop())->getValueType());
 	}
 	Struct::addStructDefinition(def);
+	this->structDefinitions.push_back(def);
 	return {};
 }
 
 ExpressionResult Lexer::parseType(const Token *token) {
-	this->currentLine->push(new TypeToken(token->getRange(), token->getStringValue()));
+	this->currentLine->push(
+		this->arena.create<TypeToken>(token->getRange(), token->getStringValue()));
 	RPNValueType type = dynamic_cast<TypeToken *>(this->currentLine->back())->getValueType();
 	if (std::get<ValueType>(type.getType()) != LIST) {
 		return {};
@@ -654,7 +822,6 @@ ExpressionResult Lexer::parseType(const Token *token) {
 	if (this->tokens.front()->getType() != TokenType::TOKEN_TYPE_LEFT_BRACKET) {
 		return {"Missing opening bracket", this->tokens.front()->getRange(), this->context};
 	}
-	delete this->tokens.front();
 	this->tokens.pop_front();
 	if (this->tokens.front()->getType() == TokenType::TOKEN_TYPE_STRUCT_NAME) {
 		dynamic_cast<TypeToken *>(this->currentLine->back())
@@ -670,13 +837,11 @@ ExpressionResult Lexer::parseType(const Token *token) {
 		return {"List type require a content type in the form 'list[type]'", token->getRange(),
 				this->context};
 	}
-	delete this->tokens.front();
 	this->tokens.pop_front();
 	if (this->tokens.front()->getType() != TokenType::TOKEN_TYPE_RIGHT_BRACKET) {
 		return {"Missing ']' after list type", this->tokens.front()->getRange(), this->context};
 	}
 	this->currentLine->back()->setRange(token->getRange().merge(this->tokens.front()->getRange()));
-	delete this->tokens.front();
 	this->tokens.pop_front();
 	return {};
 }
@@ -690,43 +855,27 @@ ExpressionResult Lexer::parseType(const Token *token) {
  * @return ExpressionResult if the line is a valid expression
  */
 ExpressionResult Lexer::tokenize(unsigned int lineNumber, std::string_view lineString,
-								 std::deque<Token *> &tokens, const ContextPtr &context) {
+								 std::deque<Token *> &tokens, Arena &arena,
+								 const ContextPtr &context) {
 	unsigned int column = 0;
-	std::string_view value;
-	matchResult result;
-	size_t i;
-	size_t matchSize;
-	bool match = false;
 	while (!lineString.empty()) {
-		i = 0;
-		match = false;
-		while (!match && i < tokenRegexes.size()) {
-			Matcher const regex = std::get<0>(tokenRegexes[i]);
-			if ((result = regex(lineString.data())).has_value()) {
-				match = true;
-				value = result.value().first;
-				matchSize = result.value().second;
-
-				TokenType const type = std::get<1>(tokenRegexes[i]);
-				if (type == TokenType::TOKEN_TYPE_COMMENT) {
-					return {};
-				}
-				if (type != TokenType::TOKEN_TYPE_INDENT) {
-					tokens.push_back(new StringToken(lineNumber, column, type, value, matchSize));
-				} else {
-					column += 1;
-				}
-			}
-			i++;
-		}
-
-		if (!match) {
+		std::optional<ScannedToken> const token = scanToken(lineString);
+		if (!token.has_value()) {
 			return {"Unexpected char : '" + std::string(1, lineString[0]) + "'",
 					TextRange(lineNumber, column, 1), context};
 		}
+		if (token->type == TokenType::TOKEN_TYPE_COMMENT) {
+			return {};
+		}
+		if (token->type != TokenType::TOKEN_TYPE_INDENT) {
+			tokens.push_back(arena.create<StringToken>(lineNumber, column, token->type,
+													   token->value, token->size));
+		} else {
+			column += 1;
+		}
 
-		column += matchSize;
-		lineString = lineString.substr(matchSize, lineString.size() - 1);
+		column += token->size;
+		lineString.remove_prefix(token->size);
 
 		// remove spaces
 		while (!lineString.empty() && lineString[0] == ' ') {
@@ -736,7 +885,6 @@ ExpressionResult Lexer::tokenize(unsigned int lineNumber, std::string_view lineS
 	}
 
 	while (!tokens.empty() && tokens.back()->getType() == TokenType::TOKEN_TYPE_END_OF_LINE) {
-		delete tokens.back();
 		tokens.pop_back();
 	}
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <charconv>
 #include <deque>
 #include <queue>
 #include <stack>
@@ -7,6 +8,7 @@
 #include <tuple>
 
 #include "analyzer/analyzer.hpp"
+#include "arena/arena.hpp"
 #include "codeblocks/blockqueue.hpp"
 #include "codeblocks/codeblock.hpp"
 #include "codeblocks/functionblock.hpp"
@@ -14,7 +16,9 @@
 #include "codeblocks/line.hpp"
 #include "expressionresult/expressionresult.hpp"
 #include "textutilities/escapecharacters.hpp"
+#include "threadpool/threadpool.hpp"
 #include "tokens/keywords.hpp"
+#include "tokens/scanner.hpp"
 #include "tokens/token.hpp"
 #include "tokens/tokens/fstringtoken.hpp"
 #include "tokens/tokens/operatortoken.hpp"
@@ -22,25 +26,38 @@
 #include "tokens/tokens/valuetoken.hpp"
 #include "tokens/tokentypes.hpp"
 #include "value/value.hpp"
+#include "value/types/struct.hpp"
 #include "value/valuetypes.hpp"
 
+class Analyzer;
 class FunctionBlock;
 
 class Lexer {
   public:
-	Lexer(const std::deque<Token *> &tokens, ContextPtr context);
-	~Lexer();
+	Lexer(const std::deque<Token *> &tokens, Arena &arena, ContextPtr context,
+		  Analyzer *analyzer = nullptr);
 
-	ExpressionResult lex();
+	ExpressionResult lex(bool analyze = true);
+	ExpressionResult feed(std::deque<Token *> tokens);
+	ExpressionResult lexLines(const std::vector<std::string_view> &lines,
+							  ThreadPool &pool = ThreadPool::shared(), bool analyze = true);
+	ExpressionResult analyze();
 
 	BlockQueue &getBlocks();
+	const std::vector<StructDefinition> &getStructDefinitions() const;
 
 	static ExpressionResult tokenize(unsigned int lineNumber, std::string_view lineString,
-									 std::deque<Token *> &tokens, const ContextPtr &context);
+									 std::deque<Token *> &tokens, Arena &arena,
+									 const ContextPtr &context);
 
   private:
+	ExpressionResult lexTokens();
 	void pushLine();
 	bool hasParentKeywordBlock(const std::vector<KeywordEnum> &keywords) const;
+	static std::string_view text(Token const *token);
+	Token *adopt(Token const *token);
+	ExpressionResult parseInt(Token const *token);
+	ExpressionResult parseFloat(Token const *token);
 	ExpressionResult parseBinNumber(Token const *token);
 	ExpressionResult parseHexNumber(Token const *token);
 	ExpressionResult parseFString(Token const *token);
@@ -57,13 +74,17 @@ class Lexer {
 
   private:
 	ContextPtr context;
-	Line *currentLine = new Line();
+	// the blocks and the tokens they contain are owned by the arena of the compilation unit, the
+	// scanned tokens may live in a shorter arena which is released after lexing
+	Arena &arena;
+	// the line which is being built, it is copied with an exact size when it is complete
+	Line *currentLine;
+	// an analyzer which outlives the lexer, the shell keeps one for the whole session
+	Analyzer *analyzer;
 	std::deque<Token *> tokens;
+	TextRange lastTokenRange;
 	std::stack<CodeBlock *> keywordBlockStack;
 	BlockQueue codeBlocks;
-	/**
-	 * @brief this member allow to track if the last token was used directly by the lexer so,
-	 * it allow to know it is necessary to clean the memory after token usage
-	 */
-	bool integrated{};
+	// the structs defined by the compilation unit, their blocks are not kept
+	std::vector<StructDefinition> structDefinitions;
 };
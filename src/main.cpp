@@ -1,16 +1,32 @@
+#include <algorithm>
+#include <charconv>
 #include <csignal>
+#include <deque>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <vector>
 
+#include "analyzer/analyzer.hpp"
+#include "cache/programcache.hpp"
 #include "context/context.hpp"
+#include "counters/counters.hpp"
 #include "cppmodule/cppmodule.hpp"
 #include "expressionresult/expressionresult.hpp"
 #include "interpreter/interpreter.hpp"
+#include "interpreter/profiler.hpp"
+#include "modules/importgraph.hpp"
+#include "modules/module.hpp"
 #include "shell/colors.hpp"
 #include "shell/shell.hpp"
+#include "textutilities/sourcefile.hpp"
 #include "textutilities/textutilities.hpp"
+#include "trace/phases.hpp"
+#include "trace/tracer.hpp"
 
 /**
  * @brief allow shell to be destroyed when ctrl+c is pressed, this allow to save the history
@@ -30,8 +46,28 @@ bool multilineKeyword(std::string_view keyword) {
 		   keyword == "struct" || keyword == "try";
 }
 
-ExpressionResult getMultilineInput(std::deque<Token *> &tokens, const ContextPtr &ctx,
-								   unsigned int &lineNumber) {
+/**
+ * @brief the text and the tokens of a shell input. They are released once the input is
+ * interpreted, unless it defines a function whose body refers to them until the end of the session
+ */
+struct ShellInput {
+	Arena arena;
+	std::deque<std::string> lines;
+
+	std::string_view keep(std::string line) {
+		return this->lines.emplace_back(std::move(line));
+	}
+};
+
+bool definesFunction(const std::deque<Token *> &tokens) {
+	return std::ranges::any_of(tokens, [](const Token *token) {
+		return token->getType() == TokenType::TOKEN_TYPE_LITERAL &&
+			   token->getStringValue() == "fun";
+	});
+}
+
+ExpressionResult getMultilineInput(std::deque<Token *> &tokens, ShellInput &input,
+								   const ContextPtr &ctx, unsigned int &lineNumber) {
 	std::string instruction{""};
 	ExpressionResult result;
 	if (!tokens.empty() && tokens.back()->getType() == TokenType::TOKEN_TYPE_LITERAL &&
@@ -42,12 +78,14 @@ ExpressionResult getMultilineInput(std::deque<Token *> &tokens, const ContextPtr
 		int emptyLines = 0;
 		while (!instruction.empty() || emptyLines < 2) {
 			if (!instruction.empty()) {
-				result = Lexer::tokenize(lineNumber, instruction, tokens, ctx);
+				result = Lexer::tokenize(lineNumber, input.keep(instruction), tokens, input.arena,
+										 ctx);
 				if (result.error()) {
 					return result;
 				}
-				tokens.push_back(new StringToken(TextRange(lineNumber, instruction.size(), 1),
-												 TokenType::TOKEN_TYPE_END_OF_LINE, "\n"));
+				tokens.push_back(
+					input.arena.create<StringToken>(TextRange(lineNumber, instruction.size(), 1),
+													TokenType::TOKEN_TYPE_END_OF_LINE, "\n"));
 			}
 			rpnShell >> instruction;
 			lineNumber += !instruction.empty();
@@ -99,8 +137,14 @@ void shellInput() {
 	LastCharBuffer lastCharBuffer(hold);
 	std::cout.rdbuf(&lastCharBuffer);
 
+	// the inputs defining a function are kept until the end of the session
+	std::vector<std::unique_ptr<ShellInput>> definitions;
 	const auto ctx = std::make_shared<Context>("main", "<stdin>");
+	ctx->trackTouchedSymbols(true);
 	Interpreter i(ctx);
+	// the analyzer keeps the types of the session so only the new input is analyzed, it is
+	// rebuilt from the context when an input fails because it may be only partially applied
+	std::optional<Analyzer> analyzer(std::in_place, ctx);
 	std::string instruction;
 	rpnShell.loadHistory();
 	rpnShell >> instruction;
@@ -108,29 +152,41 @@ void shellInput() {
 	unsigned int lineNumber = 1;
 	ExpressionResult result;
 	while (instruction != "exit" && !std::cin.eof()) {
-		result = Lexer::tokenize(lineNumber, instruction, tokens, ctx);
-		if (result.error()) {
-			result.displayLineError(instruction);
-			continue;
-		}
-		result = getMultilineInput(tokens, ctx, lineNumber);
-		if (result.error()) {
-			result.displayLineError(instruction);
-			continue;
+		auto input = std::make_unique<ShellInput>();
+		result = Lexer::tokenize(lineNumber, input->keep(instruction), tokens, input->arena, ctx);
+		if (!result.error()) {
+			result = getMultilineInput(tokens, *input, ctx, lineNumber);
 		}
-		Lexer lexer(tokens, ctx);
-		result = lexer.lex();
+		const bool keepInput = !result.error() && definesFunction(tokens);
 		if (result.error()) {
 			result.displayLineError(instruction);
 		} else {
-			Value::deleteValue(&i.getLastValue(), Value::INTERPRETER);
-			result = i.interpret(lexer.getBlocks());
-			ctx->copyTokenValues();
-			displayInterpreterResult(result, i.getLastValue(), lineNumber, instruction,
-									 lastCharBuffer.getLastChar());
-			i.clearMemory();
+			Lexer lexer(tokens, input->arena, ctx, &analyzer.value());
+			result = lexer.lex();
+			if (result.error()) {
+				result.displayLineError(instruction);
+				analyzer.emplace(ctx);
+			} else {
+				Value::deleteValue(&i.getLastValue(), Value::INTERPRETER);
+				result = i.interpret(lexer.getBlocks());
+				const std::vector<Symbol> touched = ctx->takeTouchedSymbols();
+				ctx->copyTokenValues(touched);
+				if (result.error()) {
+					analyzer.emplace(ctx);
+				} else {
+					analyzer->confirmDeclarations(touched);
+				}
+				displayInterpreterResult(result, i.getLastValue(), lineNumber, instruction,
+										 lastCharBuffer.getLastChar());
+				i.clearMemory();
+				// the last value may be owned by a token of the input
+				i.getLastValue() = nullptr;
+			}
 		}
 		tokens.clear();
+		if (keepInput) {
+			definitions.push_back(std::move(input));
+		}
 		rpnShell >> instruction;
 		if (instruction.empty()) {
 			lineNumber++;
@@ -142,31 +198,22 @@ void shellInput() {
 
 int interpretPipe() {
 	std::cout << "Interpret pipe" << std::endl;
+	Arena arena;
 	auto ctx = std::make_shared<Context>("main", "<stdin>");
 	// display the stdin content
 	std::string instruction;
-	std::deque<Token *> tokens;
-	unsigned int lineNumber = 0;
-	std::vector<std::string> lines;
-	ExpressionResult result;
+	std::vector<std::string_view> lines;
 	while (std::getline(std::cin, instruction)) {
-		lineNumber++;
-		lines.push_back(instruction);
-		result = Lexer::tokenize(lineNumber, instruction, tokens, ctx);
-		if (result.error()) {
-			result.displayLineError(instruction);
-			return 1;
-		}
-		tokens.push_back(new StringToken(TextRange(lineNumber, instruction.size(), 1),
-										 TokenType::TOKEN_TYPE_END_OF_LINE, "\n"));
+		lines.push_back(SourceFile::keep(instruction));
 	}
-	Lexer lexer(tokens, ctx);
-	result = lexer.lex();
+	Lexer lexer({}, arena, ctx);
+	ExpressionResult result = lexer.lexLines(lines);
 	if (result.error()) {
 		result.displayLineError(lines[result.getRange().line - 1]);
 		return 1;
 	}
 	Interpreter i(ctx);
+	const Phases::Scope phase("run", ctx->getName());
 	result = i.interpret(lexer.getBlocks());
 	if (result.error()) {
 		result.displayLineError(lines[result.getRange().line - 1]);
@@ -190,8 +237,132 @@ void setWorkingDirectory(const std::string_view &path) {
 	}
 }
 
+// display the modules of the program and their cost once the file is interpreted
+bool printImportGraph = false;
+// the file receiving the collapsed stacks of the profiler, empty if the program isn't profiled
+std::string profilePath;
+#ifdef RPN_COUNTERS
+// the file receiving the operation counters
+std::string countersPath;
+
+/**
+ * @brief write the operation counters, it runs at exit because the exit builtin doesn't return to
+ * main
+ */
+void writeCounters() {
+	std::ofstream file(countersPath);
+	if (!file) {
+		std::cerr << "Can't write the counters in " << countersPath << std::endl;
+		return;
+	}
+	counters::write(file);
+}
+#endif
+
+/**
+ * @brief find the signal requesting an allocation report
+ *
+ * @param name the number or the name of the signal, with or without the SIG prefix
+ * @return int the signal, 0 if the name is empty or -1 if it is unknown
+ */
+int parseSignal(std::string_view name) {
+	if (name.empty()) {
+		return 0;
+	}
+	if (name.starts_with("SIG")) {
+		name.remove_prefix(3);
+	}
+	if (name == "USR1") {
+		return SIGUSR1;
+	}
+	if (name == "USR2") {
+		return SIGUSR2;
+	}
+	if (name == "HUP") {
+		return SIGHUP;
+	}
+	int number = 0;
+	if (std::from_chars(name.data(), name.data() + name.size(), number).ptr !=
+			name.data() + name.size() ||
+		number <= 0 || number >= NSIG) {
+		return -1;
+	}
+	return number;
+}
+
+/**
+ * @brief apply the options given before the file to interpret
+ *
+ * @param argc the number of arguments
+ * @param argv the arguments
+ * @return int the index of the first argument which isn't an option, or -1 if an option is invalid
+ */
+int parseOptions(int argc, char **argv) {
+	int index = 1;
+	for (; index < argc && std::string_view(argv[index]).starts_with("--"); index++) {
+		const std::string_view option = argv[index];
+		if (option == "--no-cache") {
+			ProgramCache::setEnabled(false);
+		} else if (option == "--print-import-graph") {
+			printImportGraph = true;
+		} else if (option == "--profile" || option.starts_with("--profile=")) {
+			const std::string_view path =
+				option == "--profile" ? "rpnlang.folded" : option.substr(sizeof("--profile=") - 1);
+			// the working directory changes to the one of the script
+			profilePath = std::filesystem::absolute(path).string();
+		} else if (option == "--profile-allocations" ||
+				   option.starts_with("--profile-allocations=")) {
+			const std::string_view signalName =
+				option.substr(std::min(option.size(), sizeof("--profile-allocations=") - 1));
+			const int reportSignal = parseSignal(signalName);
+			if (reportSignal < 0) {
+				std::cout << "Unknown signal " << signalName << std::endl;
+				return -1;
+			}
+			if (!Profiler::trackAllocations(reportSignal)) {
+				std::cout << "Error: can't handle the signal " << signalName << std::endl;
+				return -1;
+			}
+		} else if (option == "--check-leaks") {
+			Profiler::checkLeaks();
+		} else if (option == "--trace" || option.starts_with("--trace=")) {
+			const std::string_view path = option == "--trace"
+											  ? "rpnlang.trace.json"
+											  : option.substr(sizeof("--trace=") - 1);
+			Tracer::start(std::filesystem::absolute(path).string());
+		} else if (option == "--time-phases") {
+			Phases::start();
+		} else if (option == "--counters" || option.starts_with("--counters=")) {
+#ifdef RPN_COUNTERS
+			const std::string_view path = option == "--counters"
+											  ? "rpnlang.counters.json"
+											  : option.substr(sizeof("--counters=") - 1);
+			countersPath = std::filesystem::absolute(path).string();
+			std::atexit(writeCounters);
+#else
+			std::cout << "The operation counters need a build configured with -DRPN_COUNTERS=ON"
+					  << std::endl;
+			return -1;
+#endif
+		} else {
+			std::cout << "Unknown option " << option << std::endl;
+			std::cout << "Usage: RPNlang [--no-cache] [--print-import-graph] [--profile[=file]] "
+						 "[--profile-allocations[=signal]] [--check-leaks] [--trace[=file]] "
+						 "[--counters[=file]] [--time-phases] [file]" << std::endl;
+			return -1;
+		}
+	}
+	return index;
+}
+
 int main(int argc, char **argv) {
 	bool result = true;
+	const int firstArgument = parseOptions(argc, argv);
+	if (firstArgument < 0) {
+		return 1;
+	}
+	argv += firstArgument - 1;
+	argc -= firstArgument - 1;
 #ifdef TEST_FILE
 	std::string path;
 	if (argc == 1) {
@@ -202,8 +373,13 @@ int main(int argc, char **argv) {
 	}
 #endif
 
-	CppModule::setBuiltinModulesPath(
-		std::filesystem::canonical(std::filesystem::current_path()).string() + "/RPNmodules");
+	{
+		const Phases::Scope phase("startup", "");
+		CppModule::registerStaticModules();
+		CppModule::setBuiltinModulesPath(
+			std::filesystem::canonical(std::filesystem::current_path()).string() +
+			"/RPNmodules");
+	}
 
 	if (!isatty(fileno(stdin))) {
 		return interpretPipe();
@@ -222,10 +398,30 @@ int main(int argc, char **argv) {
 		path = path.substr(path.find_last_of('/') + 1);
 		ContextPtr ctx = std::make_shared<Context>(name, path, CONTEXT_TYPE_FILE);
 		std::string error;
+		// the graph is only needed to be displayed, the compilation finds the imports itself
+		if (printImportGraph) {
+			const Phases::Scope phase("import graph", name);
+			ImportGraph::build(path);
+		}
+		if (!profilePath.empty() && !Profiler::start(profilePath)) {
+			std::cout << "Error: can't start the profiler" << std::endl;
+		}
 		result = Interpreter(ctx).interpretFile(path, error);
+		// every value still alive once the program is released is leaked
+		ctx->clear();
+		Module::clearContexts();
+		SourceFile::closeAll();
+		Profiler::reportLeaks(std::cerr, true);
+		Profiler::stop();
+		Tracer::stop();
 		if (!result) {
 			std::cout << error << std::endl;
 		}
+		// the test suite fails on leaks
+		result = result && Profiler::getLeakCount() == 0;
+		if (printImportGraph) {
+			ImportGraph::print(std::cerr);
+		}
 	}
 
 	std::cout << "\033[0m" << std::endl;
@@ -0,0 +1,236 @@
+#include "modules/importgraph.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <iomanip>
+
+#include "context/context.hpp"
+#include "lexer/lexer.hpp"
+#include "textutilities/escapecharacters.hpp"
+#include "textutilities/textutilities.hpp"
+#include "threadpool/threadpool.hpp"
+#include "trace/tracer.hpp"
+#include "tokens/tokens/stringtoken.hpp"
+
+bool ImportGraph::built = false;
+std::vector<ImportGraph::Node> ImportGraph::nodes;
+std::unordered_map<std::string, size_t> ImportGraph::indexes;
+std::vector<ImportGraph::Timer *> ImportGraph::timers;
+
+ImportGraph::Timer::Timer(std::string_view path) {
+	if (!ImportGraph::built) {
+		return;
+	}
+	this->timed = true;
+	this->node = ImportGraph::getNode(path);
+	this->start = std::chrono::steady_clock::now();
+	ImportGraph::timers.push_back(this);
+}
+
+ImportGraph::Timer::~Timer() {
+	if (!this->timed) {
+		return;
+	}
+	const auto end = std::chrono::steady_clock::now();
+	Node &node = ImportGraph::nodes[this->node];
+	if (this->isCompiled) {
+		node.runTime = end - this->compileEnd;
+	} else {
+		node.compileTime = end - this->start - this->importTime;
+	}
+	ImportGraph::timers.pop_back();
+	if (!ImportGraph::timers.empty()) {
+		ImportGraph::timers.back()->importTime += end - this->start;
+	}
+}
+
+/**
+ * @brief mark the end of the compilation, what follows is the execution of the file
+ *
+ * @param cached if the blocks of the file were loaded from the program cache
+ */
+void ImportGraph::Timer::compiled(bool cached) {
+	if (!this->timed) {
+		return;
+	}
+	this->compileEnd = std::chrono::steady_clock::now();
+	this->isCompiled = true;
+	Node &node = ImportGraph::nodes[this->node];
+	node.compiled = true;
+	node.cached = cached;
+	node.compileTime = this->compileEnd - this->start - this->importTime;
+}
+
+/**
+ * @brief find the modules imported by a file and by its modules. A file which can't be opened has
+ * no imports, the error is reported when the file is compiled
+ *
+ * @param entryPath the file of the program
+ */
+void ImportGraph::build(std::string_view entryPath) {
+	const Tracer::Span span("compile", "import graph");
+	ImportGraph::built = true;
+	std::vector<size_t> level = {ImportGraph::getNode(entryPath)};
+	while (!level.empty()) {
+		// SourceFile keeps a table of the mapped files, only this thread updates it
+		std::vector<std::future<std::vector<ModuleImport>>> scans;
+		for (const size_t node : level) {
+			std::string error;
+			SourceFile *source = SourceFile::open(ImportGraph::nodes[node].path, error);
+			if (source == nullptr) {
+				scans.emplace_back();
+				continue;
+			}
+			scans.push_back(
+				ThreadPool::shared().submit([source, path = ImportGraph::nodes[node].path]() {
+					const Tracer::Span span("compile", "scan " + path);
+					// the program cache needs the hash of every module
+					source->getHash();
+					return ImportGraph::scanImports(*source, path);
+				}));
+		}
+
+		std::vector<size_t> nextLevel;
+		for (size_t i = 0; i < level.size(); i++) {
+			if (!scans[i].valid()) {
+				continue;
+			}
+			for (const ModuleImport &moduleImport : scans[i].get()) {
+				const bool builtin = moduleImport.path == moduleImport.name;
+				const size_t count = ImportGraph::nodes.size();
+				const size_t imported = ImportGraph::getNode(moduleImport.path, builtin);
+				if (imported == count && !builtin) {
+					nextLevel.push_back(imported);
+				}
+				std::vector<size_t> &imports = ImportGraph::nodes[level[i]].imports;
+				if (std::ranges::find(imports, imported) == imports.end()) {
+					imports.push_back(imported);
+				}
+			}
+		}
+		level = std::move(nextLevel);
+	}
+}
+
+/**
+ * @brief display the graph from the program file with the compilation and execution time of each
+ * file, a module imported several times is only detailed once
+ *
+ * @param stream the stream to display the graph in
+ */
+void ImportGraph::print(std::ostream &stream) {
+	if (ImportGraph::nodes.empty()) {
+		return;
+	}
+	std::vector<bool> shown(ImportGraph::nodes.size(), false);
+	std::vector<Row> rows;
+	ImportGraph::collectRows(0, 0, shown, rows);
+
+	size_t width = 0;
+	for (const Row &row : rows) {
+		width = std::max(width, row.label.size());
+	}
+	auto milliseconds = [](std::chrono::nanoseconds duration) {
+		return std::chrono::duration<double, std::milli>(duration).count();
+	};
+
+	std::chrono::nanoseconds totalCompileTime{0};
+	stream << "Import graph (compile time without the imported modules, run time):" << std::endl;
+	stream << std::fixed << std::setprecision(3);
+	for (const Row &row : rows) {
+		const Node &node = ImportGraph::nodes[row.node];
+		stream << std::left << std::setw(static_cast<int>(width) + 2) << row.label;
+		if (row.repeated) {
+			stream << "see above";
+		} else if (node.builtin) {
+			stream << "builtin";
+		} else if (!node.compiled) {
+			stream << "not compiled";
+		} else {
+			stream << "compile " << milliseconds(node.compileTime) << " ms, run "
+				   << milliseconds(node.runTime) << " ms" << (node.cached ? " (cached)" : "");
+		}
+		stream << std::endl;
+	}
+	for (const Node &node : ImportGraph::nodes) {
+		totalCompileTime += node.compileTime;
+	}
+	stream << "Total compile time: " << milliseconds(totalCompileTime) << " ms" << std::endl;
+}
+
+/**
+ * @brief get the node of a file or of a builtin module, it is created if it doesn't exist. Files
+ * are identified by their absolute path so different paths to the same file share a node
+ *
+ * @param path the path of the file or the name of the builtin module
+ * @param builtin if the node is a builtin module
+ * @return size_t the index of the node
+ */
+size_t ImportGraph::getNode(std::string_view path, bool builtin) {
+	std::string key = builtin ? "builtin:" + std::string(path)
+							  : std::filesystem::absolute(path).lexically_normal().string();
+	auto [it, inserted] =
+		ImportGraph::indexes.try_emplace(std::move(key), ImportGraph::nodes.size());
+	if (inserted) {
+		ImportGraph::nodes.push_back({std::string(path), builtin});
+	}
+	return it->second;
+}
+
+/**
+ * @brief find the imports of a file, only the lines which contain an import keyword are tokenized
+ *
+ * @param source the file to scan
+ * @param path the path of the file, for the tokenizer errors
+ * @return std::vector<ModuleImport> the imports in source order
+ */
+std::vector<ModuleImport> ImportGraph::scanImports(SourceFile &source, std::string_view path) {
+	std::vector<ModuleImport> imports;
+	const auto context = std::make_shared<Context>(extractFileName(path), path);
+	Arena arena;
+	std::deque<Token *> tokens;
+	const std::vector<std::string_view> &lines = source.getLines();
+	for (size_t line = 0; line < lines.size(); line++) {
+		if (lines[line].find("import") == std::string_view::npos) {
+			continue;
+		}
+		tokens.clear();
+		if (Lexer::tokenize(line + 1, lines[line], tokens, arena, context).error()) {
+			continue;
+		}
+		auto text = [&tokens](size_t index) {
+			return static_cast<const StringToken *>(tokens[index])->getValue();
+		};
+		auto isString = [&tokens](size_t index) {
+			return tokens[index]->getType() == TokenType::TOKEN_TYPE_STRING;
+		};
+		for (size_t i = 1; i < tokens.size(); i++) {
+			if (tokens[i]->getType() != TokenType::TOKEN_TYPE_LITERAL) {
+				continue;
+			}
+			if (text(i) == "import" && isString(i - 1)) {
+				const std::string modulePath = escapeCharacters(text(i - 1));
+				imports.push_back({modulePath, extractFileName(modulePath), tokens[i]->getRange()});
+			} else if (text(i) == "importAs" && i >= 2 && isString(i - 2) && isString(i - 1)) {
+				imports.push_back({escapeCharacters(text(i - 2)), escapeCharacters(text(i - 1)),
+								   tokens[i]->getRange()});
+			}
+		}
+	}
+	return imports;
+}
+
+void ImportGraph::collectRows(size_t node, size_t depth, std::vector<bool> &shown,
+							  std::vector<Row> &rows) {
+	const std::string indent(depth * 2, ' ');
+	rows.push_back({indent + ImportGraph::nodes[node].path, node, shown[node]});
+	if (shown[node]) {
+		return;
+	}
+	shown[node] = true;
+	for (const size_t imported : ImportGraph::nodes[node].imports) {
+		ImportGraph::collectRows(imported, depth + 1, shown, rows);
+	}
+}
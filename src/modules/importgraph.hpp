@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "modules/moduleimport.hpp"
+#include "textutilities/sourcefile.hpp"
+
+/**
+ * @brief the modules imported by a program, directly or not. The graph is only built when it is
+ * displayed, before the program is compiled: the files are mapped on this thread, then they are
+ * hashed and their imports are found on the thread pool, one level of the graph at a time. The
+ * compilation of each file is then timed to report the cost of each module
+ */
+class ImportGraph {
+  public:
+	/**
+	 * @brief time the compilation and the execution of a file, the time spent loading the
+	 * modules it imports is not counted in its compilation time. It does nothing if the graph
+	 * hasn't been built
+	 */
+	class Timer {
+	  public:
+		explicit Timer(std::string_view path);
+		Timer(const Timer &other) = delete;
+		Timer &operator=(const Timer &other) = delete;
+		~Timer();
+
+		void compiled(bool cached);
+
+	  private:
+		bool timed = false;
+		size_t node = 0;
+		std::chrono::steady_clock::time_point start;
+		std::chrono::steady_clock::time_point compileEnd;
+		std::chrono::nanoseconds importTime{0};
+		bool isCompiled = false;
+	};
+
+	static void build(std::string_view entryPath);
+	static void print(std::ostream &stream);
+
+  private:
+	struct Node {
+		std::string path;
+		bool builtin = false;
+		std::vector<size_t> imports;
+		bool compiled = false;
+		bool cached = false;
+		std::chrono::nanoseconds compileTime{0};
+		std::chrono::nanoseconds runTime{0};
+	};
+
+	struct Row {
+		std::string label;
+		size_t node;
+		bool repeated;
+	};
+
+	static size_t getNode(std::string_view path, bool builtin = false);
+	static std::vector<ModuleImport> scanImports(SourceFile &source, std::string_view path);
+	static void collectRows(size_t node, size_t depth, std::vector<bool> &shown,
+							std::vector<Row> &rows);
+
+	static bool built;
+	static std::vector<Node> nodes;
+	static std::unordered_map<std::string, size_t> indexes;
+	// the files being compiled, the innermost is the last one
+	static std::vector<Timer *> timers;
+};
@@ -1,5 +1,8 @@
 #include "modules/module.hpp"
 
+#include "counters/counters.hpp"
+#include "trace/tracer.hpp"
+
 Module::Module() : importRange(TextRange(0, 0, 0)), context(nullptr) {}
 
 Module::Module(std::string_view path, std::string_view name, ContextPtr parentContext,
@@ -25,15 +28,67 @@ ExpressionResult Module::load() {
 		throw std::runtime_error("Module::load: context is null");
 	}
 
+	const Tracer::Span span("import", this->path);
 	auto moduleLoader = Interpreter(this->context);
 	if (std::string error; !moduleLoader.interpretFile(path, error, true)) {
 		return {"Failed to load module " + name + " at " + path + "(" + error + ")",
 				this->importRange, this->context->getParent()};
 	}
 
+	this->interfaceHash = this->computeInterfaceHash(moduleLoader.getStructDefinitions(),
+													moduleLoader.getImports());
 	return {};
 }
 
+/**
+ * @brief hash what the analysis of an importer can depend on: the names and types of the module
+ * values, the signatures of its functions, its structs and the interfaces of the modules it
+ * imports. A change in the module which keeps the same interface doesn't invalidate the cache of
+ * its importers
+ *
+ * @param structDefinitions the structs defined by the module
+ * @param imports the imports made by the module
+ * @return uint64_t the hash of the interface, never 0
+ */
+uint64_t Module::computeInterfaceHash(const std::vector<StructDefinition> &structDefinitions,
+									  const std::vector<ModuleImport> &imports) const {
+	std::vector<std::string> entries;
+	for (const auto &[symbol, value] : this->context->getSymbols()) {
+		std::string entry = symbol.name() + ":" + std::to_string(value->getType());
+		if (value->getType() == FUNCTION) {
+			const FunctionSignature signature =
+				dynamic_cast<const Function *>(value)->getValue()->getSignature();
+			for (const RPNValueType &arg : signature.args) {
+				entry += ' ';
+				entry += arg.name();
+			}
+			entry += " -> " + signature.returnType.name();
+		}
+		entries.push_back(std::move(entry));
+	}
+	std::ranges::sort(entries);
+
+	for (const StructDefinition &definition : structDefinitions) {
+		std::string entry = "struct " + definition.getName();
+		const std::vector<std::string> members = definition.getMembersOrder();
+		for (size_t i = 0; i < members.size(); i++) {
+			entry += " " + members[i] + ":" + definition.getMemberType(i).name();
+		}
+		entries.push_back(std::move(entry));
+	}
+	for (const ModuleImport &moduleImport : imports) {
+		std::shared_ptr<Module> const module = Module::getModule(moduleImport.name);
+		entries.push_back("import " + moduleImport.name + " " +
+						  std::to_string(module != nullptr ? module->interfaceHash : 0));
+	}
+
+	std::string interface;
+	for (const std::string &entry : entries) {
+		interface += entry + "\n";
+	}
+	return std::max<uint64_t>(std::hash<std::string>()(interface), 1);
+}
+
 /**
  * @brief return the module context
  *
@@ -50,6 +105,60 @@ std::string Module::getPath() const {
 	return this->path;
 }
 
+/**
+ * @brief get the hash of the module interface, see computeInterfaceHash
+ *
+ * @return uint64_t the hash or 0 if the module is still being loaded
+ */
+uint64_t Module::getInterfaceHash() const {
+	return this->interfaceHash;
+}
+
+/**
+ * @brief get a user defined module by name
+ *
+ * @param name the name of the module
+ * @return std::shared_ptr<Module> the module or nullptr if there is no user module with this name
+ */
+std::shared_ptr<Module> Module::getModule(const std::string &name) {
+	auto it = Module::modules.find(name);
+	if (it == Module::modules.end()) {
+		return nullptr;
+	}
+	return it->second;
+}
+
+/**
+ * @brief release the variables of every module, only when the program exits since the values of
+ * the modules can be used until then
+ */
+void Module::clearContexts() {
+	for (auto &[_, module] : Module::modules) {
+		if (module->context != nullptr) {
+			module->context->clear();
+		}
+	}
+	for (auto &[_, module] : Module::builtinModules) {
+		module.getModuleContext()->clear();
+	}
+}
+
+/**
+ * @brief get the imports made by a context since the last call, in the order they were made
+ *
+ * @param context the context which imported the modules
+ * @return std::vector<ModuleImport> the imports
+ */
+std::vector<ModuleImport> Module::takeImports(const ContextPtr &context) {
+	auto it = Module::imports.find(context.get());
+	if (it == Module::imports.end()) {
+		return {};
+	}
+	std::vector<ModuleImport> contextImports = std::move(it->second);
+	Module::imports.erase(it);
+	return contextImports;
+}
+
 /**
  * @brief check if a given string is a module name
  *
@@ -78,11 +187,11 @@ bool Module::isModule(const std::string &moduleName, bool &isBuiltin) {
  */
 bool Module::hasValue(const Path *path) {
 	if (path->getType() == PATH) {
-		return Module::modules.at(path->ats(0))->getModuleContext()->hasValue(path->ats(1));
+		return Module::modules.at(path->symbol(0))->getModuleContext()->hasValue(path->ats(1));
 	}
 
 	if (path->getType() == BUILTIN_PATH)
-		return Module::builtinModules.at(path->ats(0)).getModuleContext()->hasValue(path->ats(1));
+		return Module::builtinModules.at(path->symbol(0)).getModuleContext()->hasValue(path->ats(1));
 
 	throw std::invalid_argument("This path is not a module path");
 }
@@ -117,14 +226,17 @@ ExpressionResult Module::checkPath(const Path *path, const ContextPtr &parentCon
  * @return ExpressionResult if the value exists
  */
 Value *&Module::getModuleValue(const Value *valuePath) {
+	RPN_COUNT(MODULE_LOOKUPS);
 	const auto *path = dynamic_cast<const Path *>(valuePath);
 
 	if (path->getType() == PATH) {
-		return Module::modules.at(path->ats(0))->getModuleContext()->getValue(path->ats(1));
+		return Module::modules.at(path->symbol(0))->getModuleContext()->getValue(path->symbol(1));
 	}
 	
 	if (path->getType() == BUILTIN_PATH) {
-		return Module::builtinModules.at(path->ats(0)).getModuleContext()->getValue(path->ats(1));
+		return Module::builtinModules.at(path->symbol(0))
+			.getModuleContext()
+			->getValue(path->symbol(1));
 	}
 	
 	throw std::invalid_argument("This path is not a module path");
@@ -139,12 +251,13 @@ Value *&Module::getModuleValue(const Value *valuePath) {
  * @return ExpressionResult
  */
 ContextPtr Module::getModuleContext(const Value *valuePath, const ContextPtr &parentContext) {
+	RPN_COUNT(MODULE_LOOKUPS);
 	auto const path = dynamic_cast<const Path *>(valuePath);
 	ContextPtr moduleContext;
 	if (path->getType() == PATH) {
-		moduleContext = Module::modules.at(path->ats(0))->getModuleContext();
+		moduleContext = Module::modules.at(path->symbol(0))->getModuleContext();
 	} else if (path->getType() == BUILTIN_PATH) {
-		moduleContext = Module::builtinModules.at(path->ats(0)).getModuleContext();
+		moduleContext = Module::builtinModules.at(path->symbol(0)).getModuleContext();
 	} else {
 		throw std::runtime_error("This path is not a module path");
 	}
@@ -167,7 +280,7 @@ bool Module::isImported(std::string_view modulePath, std::string &moduleName) {
 		return false;
 	}
 
-	moduleName = it->first;
+	moduleName = it->first.name();
 	return true;
 }
 
@@ -182,6 +295,8 @@ bool Module::isImported(std::string_view modulePath, std::string &moduleName) {
  */
 ExpressionResult Module::addModule(std::string_view modulePath, const std::string &name,
 								   TextRange importRange, const ContextPtr &parentContext) {
+	Module::imports[parentContext.get()].push_back(
+		{std::string(modulePath), name, importRange});
 	std::string importedName;
 	// check if the module is user defined
 	if (modulePath != name) {
@@ -201,12 +316,16 @@ ExpressionResult Module::addModule(std::string_view modulePath, const std::strin
 		return {"Builtin module '" + name + "' does not exist", importRange, parentContext};
 	}
 
+	// the functions of a module imported from its manifest refer to it, it must not be replaced
+	if (builtinModules.contains(name)) {
+		return {};
+	}
 	builtinModules[name] = CppModule(name);
 	return builtinModules[name].load(importRange);
 }
 
-std::unordered_map<std::string, std::shared_ptr<Module>, StringHash, std::equal_to<>>
-	Module::modules =
-		std::unordered_map<std::string, std::shared_ptr<Module>, StringHash, std::equal_to<>>();
-std::unordered_map<std::string, CppModule, StringHash, std::equal_to<>> Module::builtinModules =
-	std::unordered_map<std::string, CppModule, StringHash, std::equal_to<>>();
+std::unordered_map<Symbol, std::shared_ptr<Module>, SymbolHash> Module::modules =
+	std::unordered_map<Symbol, std::shared_ptr<Module>, SymbolHash>();
+std::unordered_map<Symbol, CppModule, SymbolHash> Module::builtinModules =
+	std::unordered_map<Symbol, CppModule, SymbolHash>();
+std::unordered_map<const Context *, std::vector<ModuleImport>> Module::imports;
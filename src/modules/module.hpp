@@ -4,10 +4,11 @@
 #include <stdexcept>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 class CppModule;
 
-#include "textutilities/stringhash.hpp"
+#include "textutilities/symbol.hpp"
 
 #include "value/types/path.hpp"
 #include "value/value.hpp"
@@ -16,6 +17,7 @@ class CppModule;
 #include "cppmodule/cppmodule.hpp"
 #include "expressionresult/expressionresult.hpp"
 #include "interpreter/interpreter.hpp"
+#include "modules/moduleimport.hpp"
 #include "rpnfunctions/typedef.hpp"
 #include "textutilities/textrange.hpp"
 
@@ -31,6 +33,7 @@ class Module {
 
 	ContextPtr getModuleContext() const;
 	std::string getPath() const;
+	uint64_t getInterfaceHash() const;
 
 	static bool isModule(const std::string &moduleName, bool &isBuiltin);
 	static bool isImported(std::string_view modulePath, std::string &moduleName);
@@ -42,14 +45,23 @@ class Module {
 									  TextRange importRange, const ContextPtr &context);
 	static Value *&getModuleValue(const Value *valuePath);
 	static ContextPtr getModuleContext(const Value *valuePath, const ContextPtr &parentContext);
+	static std::shared_ptr<Module> getModule(const std::string &name);
+	static std::vector<ModuleImport> takeImports(const ContextPtr &context);
+	static void clearContexts();
 
   private:
+	uint64_t computeInterfaceHash(const std::vector<StructDefinition> &structDefinitions,
+								  const std::vector<ModuleImport> &imports) const;
+
 	std::string path;
 	std::string name;
 	TextRange importRange;
 	ContextPtr context;
+	// 0 until the module is loaded
+	uint64_t interfaceHash = 0;
 
-	static std::unordered_map<std::string, std::shared_ptr<Module>, StringHash, std::equal_to<>>
-		modules;
-	static std::unordered_map<std::string, CppModule, StringHash, std::equal_to<>> builtinModules;
+	static std::unordered_map<Symbol, std::shared_ptr<Module>, SymbolHash> modules;
+	static std::unordered_map<Symbol, CppModule, SymbolHash> builtinModules;
+	// imports made by each context which were not taken yet
+	static std::unordered_map<const Context *, std::vector<ModuleImport>> imports;
 };
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+
+#include "textutilities/textrange.hpp"
+
+/**
+ * @brief an import made by the analysis of a compilation unit, the program cache replays them
+ */
+struct ModuleImport {
+	std::string path;
+	std::string name;
+	TextRange range;
+};
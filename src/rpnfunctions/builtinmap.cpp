@@ -1,257 +1,523 @@
 #include "rpnfunctions/builtinmap.hpp"
 
-ExpressionResult checkListType(const List *list, const Value *val, ContextPtr context) {
+/**
+ * @brief get the range of an argument, the shared constant values have no range so the range of
+ * the call is used for them
+ *
+ * @param argument the argument
+ * @param callRange the range of the function call
+ * @return TextRange the range to report an error about the argument
+ */
+TextRange argumentRange(const Value *argument, const TextRange &callRange) {
+	return argument->getOwner() == Value::CONSTANT ? callRange : argument->getRange();
+}
+
+ExpressionResult checkListType(const List *list, const Value *val, const TextRange &range,
+							   ContextPtr context) {
 	RPNBaseType listType = list->getListType();
 	if (listType.index() == 0) {
-		if (val->getType() != STRUCT &&
+		if (val->getType() != STRUCT ||
 			dynamic_cast<const Struct *>(val)->getStructName() != std::get<std::string>(listType)) {
 			return {"List is of type " + std::get<std::string>(listType) +
 						" but value is of type " + val->getStringType(),
-					val->getRange(), context};
+					argumentRange(val, range), context};
 		}
 		return {};
 	}
 	if (!RPNValueType::isCastableTo(val->getType(), std::get<ValueType>(listType))) {
 		return {"List is of type " + stringType(std::get<ValueType>(listType)) +
 					" but value is of type " + val->getStringType(),
-				val->getRange(), context};
+				argumentRange(val, range), context};
+	}
+	return {};
+}
+
+ExpressionResult checkNumericList(const List *list, bool allowEmpty, ContextPtr context) {
+	if (!list->isNumeric()) {
+		return {"List must only contain numbers", list->getRange(), context};
+	}
+	if (!allowEmpty && list->size() == 0) {
+		return {"List is empty", list->getRange(), context};
 	}
 	return {};
 }
 
-const std::unordered_map<std::string, BuiltinRPNFunction> builtins::builtinFunctions = {
-	{"print", BuiltinRPNFunction("print", {{"value", STRING}}, NONE,
-								 [](RPNFunctionArgsValue &args, const TextRange & /*range*/,
-									ContextPtr /*context*/) -> RPNFunctionResult {
-									 std::cout << args[0]->getStringValue();
-									 return None::empty();
-								 })},
-	{"input", BuiltinRPNFunction("input", {{"value", STRING}}, STRING,
-								 [](RPNFunctionArgsValue &args, const TextRange &range,
-									ContextPtr /*context*/) -> RPNFunctionResult {
-									 std::cout << args[0]->getStringValue();
-									 std::string input;
-									 std::getline(std::cin, input);
-									 return new String(input, range, Value::INTERPRETER);
-								 })},
-	{"getChr", BuiltinRPNFunction("getChr", {}, STRING,
-								  [](RPNFunctionArgsValue & /*args*/, const TextRange &range,
-									 ContextPtr /*context*/) -> RPNFunctionResult {
-									  char const c = std::getchar();
-									  return new String(std::string(1, c), range,
-														Value::INTERPRETER);
-								  })},
-	{"len", BuiltinRPNFunction("len", {{"value", ANY}}, INT,
-							   [](RPNFunctionArgsValue &args, const TextRange &range,
-								  ContextPtr /*context*/) -> RPNFunctionResult {
-								   if (args[0]->getType() == LIST) {
-									   return new Int(dynamic_cast<List *>(args[0])->size(), range,
-													  Value::INTERPRETER);
-								   }
+/**
+ * @brief check if a list is declared to only hold integers, the reductions of such a list are
+ * integers too so they don't lose precision, like ReturnRule::LIST_ELEMENTS tells the analyzer
+ */
+bool holdsIntegers(const List *list) {
+	const RPNBaseType type = list->getListType();
+	return type.index() == 1 &&
+		   (std::get<ValueType>(type) == INT || std::get<ValueType>(type) == BOOL);
+}
+
+/**
+ * @brief create the result of the reduction of integers, an int for lists of integers and a
+ * float for the lists typed any like the analyzer expects
+ */
+Value *integerReduction(int64_t value, bool integral, const TextRange &range) {
+	if (integral) {
+		return new Int(value, range, Value::INTERPRETER);
+	}
+	return new Float(static_cast<float>(value), range, Value::INTERPRETER);
+}
+
+namespace {
+using BuiltinFunctionPointer = RPNFunctionResult (*)(RPNFunctionArgsValue &, const TextRange &,
+													 ContextPtr);
+
+struct BuiltinType {
+	constexpr BuiltinType() = default;
+	constexpr BuiltinType(ValueType type, ValueType listType = NONE)
+		: type(type), listType(listType) {}
+
+	ValueType type = NONE;
+	ValueType listType = NONE;
+};
+
+struct BuiltinArgument {
+	std::string_view name;
+	BuiltinType type;
+};
+
+/**
+ * @brief description of a builtin function, the table is built at compile time and the
+ * BuiltinRPNFunction objects are only created the first time a builtin is looked up
+ */
+struct BuiltinDescription {
+	static constexpr size_t maxArguments = 3;
+
+	constexpr BuiltinDescription(std::string_view name,
+								 std::initializer_list<BuiltinArgument> arguments,
+								 BuiltinType returnType, BuiltinFunctionPointer function)
+		: BuiltinDescription(name, arguments, returnType, ReturnRule::DECLARED, function) {}
+
+	constexpr BuiltinDescription(std::string_view name,
+								 std::initializer_list<BuiltinArgument> arguments,
+								 BuiltinType returnType, ReturnRule returnRule,
+								 BuiltinFunctionPointer function)
+		: name(name), argumentsCount(arguments.size()), returnType(returnType),
+		  returnRule(returnRule), function(function) {
+		std::ranges::copy(arguments, this->arguments.begin());
+	}
+
+	std::string_view name;
+	std::array<BuiltinArgument, maxArguments> arguments{};
+	size_t argumentsCount;
+	BuiltinType returnType;
+	ReturnRule returnRule;
+	BuiltinFunctionPointer function;
+};
+
+constexpr BuiltinDescription descriptions[] = {
+	{"print", {{"value", STRING}}, NONE,
+	 [](RPNFunctionArgsValue &args, const TextRange & /*range*/,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 std::cout << args[0]->getStringValue();
+		 return None::empty();
+	 }},
+	{"input", {{"value", STRING}}, STRING,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 std::cout << args[0]->getStringValue();
+		 std::string input;
+		 std::getline(std::cin, input);
+		 return new String(input, range, Value::INTERPRETER);
+	 }},
+	{"getChr", {}, STRING,
+	 [](RPNFunctionArgsValue & /*args*/, const TextRange &range,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 char const c = std::getchar();
+		 return new String(std::string(1, c), range, Value::INTERPRETER);
+	 }},
+	{"len", {{"value", ANY}}, INT,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 if (args[0]->getType() == LIST) {
+			 return new Int(dynamic_cast<List *>(args[0])->size(), range, Value::INTERPRETER);
+		 }
+
+		 return new Int(args[0]->getStringValue().size(), range, Value::INTERPRETER);
+	 }},
+	{"substr", {{"value", STRING}, {"start", INT}, {"length", INT}}, STRING,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 const std::string value = args[0]->getStringValue();
+		 int64_t const start = dynamic_cast<Int *>(args[1])->getValue();
+		 int64_t const length = dynamic_cast<Int *>(args[2])->getValue();
+		 return new String(std::string_view(value).substr(start, length), range,
+						   Value::INTERPRETER);
+	 }},
+	{"isNumber", {{"value", STRING}}, BOOL,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 const std::string value = args[0]->getStringValue();
+		 std::optional<ScannedToken> result;
+		 bool const isNumber =
+			 value == "true" || value == "false" ||
+			 ((result = scanFloat(value)) && result->size == value.size()) ||
+			 ((result = scanInt(value)) && result->size == value.size());
+		 return new Bool(isNumber, range, Value::INTERPRETER);
+	 }},
+	{"toInt", {{"value", STRING}}, INT,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 if (scanInt(args[0]->getStringValue())) {
+			 return new Int(std::stoi(args[0]->getStringValue()), range, Value::INTERPRETER);
+		 }
+		 return ExpressionResult("Cannot convert '" + args[0]->getStringValue() + "' to int",
+								 args[0]->getRange(), context);
+	 }},
+	{"toFloat", {{"value", STRING}}, FLOAT,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 if (scanNumber(args[0]->getStringValue())) {
+			 return new Float(std::stof(args[0]->getStringValue()), range, Value::INTERPRETER);
+		 }
+		 return ExpressionResult("Cannot convert '" + args[0]->getStringValue() + "' to float",
+								 args[0]->getRange(), context);
+	 }},
+	{"toString", {{"value", FLOAT}}, STRING,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 return new String(args[0]->getStringValue(), range, Value::INTERPRETER);
+	 }},
+	{"and", {{"value1", BOOL}, {"value2", BOOL}}, BOOL,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 return new Bool(dynamic_cast<Bool *>(args[0])->getValue() &&
+							 dynamic_cast<Bool *>(args[1])->getValue(),
+						 range, Value::INTERPRETER);
+	 }},
+	{"or", {{"value1", BOOL}, {"value2", BOOL}}, BOOL,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 return new Bool(dynamic_cast<Bool *>(args[0])->getValue() ||
+							 dynamic_cast<Bool *>(args[1])->getValue(),
+						 range, Value::INTERPRETER);
+	 }},
+	{"not", {{"value", BOOL}}, BOOL,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 return new Bool(!dynamic_cast<Bool *>(args[0])->getValue(), range, Value::INTERPRETER);
+	 }},
+	{"ord", {{"value", STRING}}, INT,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 if (args[0]->getStringValue().size() != 1) {
+			 return ExpressionResult("string must have length of 1", args[0]->getRange(), context);
+		 }
+
+		 return new Int(static_cast<int64_t>(args[0]->getStringValue()[0]), range,
+						Value::INTERPRETER);
+	 }},
+	{"chr", {{"value", INT}}, STRING,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 return new String(
+			 std::string(1, static_cast<char>(dynamic_cast<Int *>(args[0])->getValue())),
+			 range, Value::INTERPRETER);
+	 }},
+	{"exit", {{"value", INT}}, NONE,
+	 [](RPNFunctionArgsValue &args, const TextRange & /*range*/,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 exit(dynamic_cast<Int *>(args[0])->getValue());
+		 // Should never reach this point
+		 return None::empty();
+	 }},
+	{"assert", {{"value", BOOL}}, NONE,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 ExpressionResult const result;
 
-								   return new Int(args[0]->getStringValue().size(), range,
-												  Value::INTERPRETER);
-							   })},
-	{"substr",
-	 BuiltinRPNFunction("substr", {{"value", STRING}, {"start", INT}, {"length", INT}}, STRING,
-						[](RPNFunctionArgsValue &args, const TextRange &range,
-						   ContextPtr /*context*/) -> RPNFunctionResult {
-							const std::string value = args[0]->getStringValue();
-							int64_t const start = dynamic_cast<Int *>(args[1])->getValue();
-							int64_t const length = dynamic_cast<Int *>(args[2])->getValue();
-							return new String(std::string_view(value).substr(start, length), range,
-											  Value::INTERPRETER);
-						})},
-	{"isNumber", BuiltinRPNFunction("isNumber", {{"value", STRING}}, BOOL,
-									[](RPNFunctionArgsValue &args, const TextRange &range,
-									   ContextPtr /*context*/) -> RPNFunctionResult {
-										const std::string value = args[0]->getStringValue();
-										matchResult result;
-										bool const isNumber =
-											value == "true" || value == "false" ||
-											((result = floatMatch(value)) &&
-											 result.value().second == value.size()) ||
-											((result = intMatch(value)) &&
-											 result.value().second == value.size());
-										return new Bool(isNumber, range, Value::INTERPRETER);
-									})},
-	{"toInt", BuiltinRPNFunction("toInt", {{"value", STRING}}, INT,
-								 [](RPNFunctionArgsValue &args, const TextRange &range,
-									ContextPtr context) -> RPNFunctionResult {
-									 if (intMatch(args[0]->getStringValue().data())) {
-										 return new Int(std::stoi(args[0]->getStringValue()), range,
-														Value::INTERPRETER);
-									 }
-									 return ExpressionResult("Cannot convert '" +
-																 args[0]->getStringValue() +
-																 "' to int",
-															 args[0]->getRange(), context);
-								 })},
-	{"toFloat", BuiltinRPNFunction("toFloat", {{"value", STRING}}, FLOAT,
-								   [](RPNFunctionArgsValue &args, const TextRange &range,
-									  ContextPtr context) -> RPNFunctionResult {
-									   if (floatMatch(args[0]->getStringValue().data()) ||
-										   intMatch(args[0]->getStringValue().data())) {
-										   return new Float(std::stof(args[0]->getStringValue()),
-															range, Value::INTERPRETER);
-									   }
-									   return ExpressionResult("Cannot convert '" +
-																   args[0]->getStringValue() +
-																   "' to float",
-															   args[0]->getRange(), context);
-								   })},
-	{"toString", BuiltinRPNFunction("toString", {{"value", FLOAT}}, STRING,
-									[](RPNFunctionArgsValue &args, const TextRange &range,
-									   ContextPtr /*context*/) -> RPNFunctionResult {
-										return new String(args[0]->getStringValue(), range,
-														  Value::INTERPRETER);
-									})},
-	{"and", BuiltinRPNFunction("and", {{"value1", BOOL}, {"value2", BOOL}}, BOOL,
-							   [](RPNFunctionArgsValue &args, const TextRange &range,
-								  ContextPtr /*context*/) -> RPNFunctionResult {
-								   return new Bool(dynamic_cast<Bool *>(args[0])->getValue() &&
-													   dynamic_cast<Bool *>(args[1])->getValue(),
-												   range, Value::INTERPRETER);
-							   })},
-	{"or", BuiltinRPNFunction("or", {{"value1", BOOL}, {"value2", BOOL}}, BOOL,
-							  [](RPNFunctionArgsValue &args, const TextRange &range,
-								 ContextPtr /*context*/) -> RPNFunctionResult {
-								  return new Bool(dynamic_cast<Bool *>(args[0])->getValue() ||
-													  dynamic_cast<Bool *>(args[1])->getValue(),
-												  range, Value::INTERPRETER);
-							  })},
-	{"not", BuiltinRPNFunction("not", {{"value", BOOL}}, BOOL,
-							   [](RPNFunctionArgsValue &args, const TextRange &range,
-								  ContextPtr /*context*/) -> RPNFunctionResult {
-								   return new Bool(!dynamic_cast<Bool *>(args[0])->getValue(),
-												   range, Value::INTERPRETER);
-							   })},
-	{"ord", BuiltinRPNFunction("ord", {{"value", STRING}}, INT,
-							   [](RPNFunctionArgsValue &args, const TextRange &range,
-								  ContextPtr context) -> RPNFunctionResult {
-								   if (args[0]->getStringValue().size() != 1) {
-									   return ExpressionResult("string must have length of 1",
-															   args[0]->getRange(), context);
-								   }
+		 if (!dynamic_cast<Bool *>(args[0])->getValue()) {
+			 return ExpressionResult("Assertion failed", range, context->getParent());
+		 }
 
-								   return new Int(
-									   static_cast<int64_t>(args[0]->getStringValue()[0]), range,
-									   Value::INTERPRETER);
-							   })},
-	{"chr", BuiltinRPNFunction(
-				"chr", {{"value", INT}}, STRING,
-				[](RPNFunctionArgsValue &args, const TextRange &range,
-				   ContextPtr /*context*/) -> RPNFunctionResult {
-					return new String(
-						std::string(1, static_cast<char>(dynamic_cast<Int *>(args[0])->getValue())),
-						range, Value::INTERPRETER);
-				})},
-	{"exit", BuiltinRPNFunction("exit", {{"value", INT}}, NONE,
-								[](RPNFunctionArgsValue &args, const TextRange & /*range*/,
-								   ContextPtr /*context*/) -> RPNFunctionResult {
-									exit(dynamic_cast<Int *>(args[0])->getValue());
-									// Should never reach this point
-									return None::empty();
-								})},
-	{"assert", BuiltinRPNFunction("assert", {{"value", BOOL}}, NONE,
-								  [](RPNFunctionArgsValue &args, const TextRange &range,
-									 ContextPtr context) -> RPNFunctionResult {
-									  ExpressionResult const result;
+		 return None::empty();
+	 }},
+	{"at", {{"value", STRING}, {"index", INT}}, STRING,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 auto index = dynamic_cast<Int *>(args[1]);
+		 Value *value = nullptr;
+		 std::string string = args[0]->getStringValue();
+		 if (index->getValue() < 0 || (size_t)index->getValue() >= string.size()) {
+			 return ExpressionResult("Index out of range", argumentRange(args[1], range),
+									 context);
+		 }
+		 TextRange charRange = args[0]->getRange();
+		 charRange.columnStart += index->getValue();
+		 charRange.columnEnd = charRange.columnStart + 1;
+		 value = new String(std::string(string[index->getValue()], 1), charRange,
+							Value::INTERPRETER);
 
-									  if (!dynamic_cast<Bool *>(args[0])->getValue()) {
-										  return ExpressionResult("Assertion failed", range,
-																  context->getParent());
-									  }
+		 value->setVariableRange(TextRange::merge(args[0]->getRange(), range));
+		 return value;
+	 }},
+	{"push", {{"list", {LIST, ANY}}, {"value", ANY}}, NONE,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 auto *list = dynamic_cast<List *>(args[0]);
+		 if (ExpressionResult result = checkListType(list, args[1], range, context);
+			 result.error()) {
+			 return result;
+		 }
+		 if (!list->isColumnar() &&
+			 (args[1]->getOwner() == Value::CONTEXT_VARIABLE ||
+			  args[1]->getOwner() == Value::OBJECT_VALUE)) {
+			 list->push(args[1]->copy(Value::OBJECT_VALUE));
+		 } else {
+			 list->push(args[1]);
+		 }
+		 return None::empty();
+	 }},
+	{"pop", {{"list", {LIST, ANY}}}, NONE,
+	 [](RPNFunctionArgsValue &args, const TextRange & /*range*/,
+		ContextPtr context) -> RPNFunctionResult {
+		 auto *list = dynamic_cast<List *>(args[0]);
+		 if (list->size() == 0) {
+			 return ExpressionResult("Cannot pop from empty list", args[0]->getRange(), context);
+		 }
+		 Value *value = list->pop();
+		 Value::deleteValue(&value, Value::OBJECT_VALUE);
+		 return None::empty();
+	 }},
+	{"insert", {{"list", {LIST, ANY}}, {"index", INT}, {"value", ANY}}, NONE,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 auto *list = dynamic_cast<List *>(args[0]);
+		 if (ExpressionResult result = checkListType(list, args[2], range, context);
+			 result.error()) {
+			 return result;
+		 }
+		 auto index = dynamic_cast<Int *>(args[1]);
 
-									  return None::empty();
-								  })},
-	{"at", BuiltinRPNFunction(
-			   "at", {{"value", STRING}, {"index", INT}}, STRING,
-			   [](RPNFunctionArgsValue &args, const TextRange &range,
-				  ContextPtr context) -> RPNFunctionResult {
-				   auto index = dynamic_cast<Int *>(args[1]);
-				   Value *value = nullptr;
-				   std::string string = args[0]->getStringValue();
-				   if (index->getValue() < 0 || (size_t)index->getValue() >= string.size()) {
-					   return ExpressionResult("Index out of range", args[1]->getRange(), context);
-				   }
-				   TextRange charRange = args[0]->getRange();
-				   charRange.columnStart += index->getValue();
-				   charRange.columnEnd = charRange.columnStart + 1;
-				   value = new String(std::string(string[index->getValue()], 1), charRange,
-									  Value::INTERPRETER);
+		 if (index->getValue() < 0 || index->getValue() > list->size()) {
+			 return ExpressionResult("Index out of range", argumentRange(args[1], range),
+									 context);
+		 }
+		 if (!list->isColumnar() &&
+			 (args[2]->getOwner() == Value::CONTEXT_VARIABLE ||
+			  args[2]->getOwner() == Value::OBJECT_VALUE)) {
+			 list->insert(index->getValue(), args[2]->copy(Value::OBJECT_VALUE));
+		 } else {
+			 list->insert(index->getValue(), args[2]);
+		 }
+		 return None::empty();
+	 }},
+	{"remove", {{"list", {LIST, ANY}}, {"index", INT}}, NONE,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 auto *list = dynamic_cast<List *>(args[0]);
+		 auto const index = dynamic_cast<Int *>(args[1]);
+		 if (index->getValue() < 0 || index->getValue() >= list->size()) {
+			 return ExpressionResult("Index out of range", argumentRange(args[1], range),
+									 context);
+		 }
 
-				   value->setVariableRange(TextRange::merge(args[0]->getRange(), range));
-				   return value;
-			   })},
-	{"push", BuiltinRPNFunction("push", {{"list", {LIST, ANY}}, {"value", ANY}}, NONE,
-								[](RPNFunctionArgsValue &args, const TextRange & /*range*/,
-								   ContextPtr context) -> RPNFunctionResult {
-									auto *list = dynamic_cast<List *>(args[0]);
-									if (ExpressionResult result =
-											checkListType(list, args[1], context);
-										result.error()) {
-										return result;
-									}
-									if (args[1]->getOwner() == Value::CONTEXT_VARIABLE ||
-										args[1]->getOwner() == Value::OBJECT_VALUE) {
-										list->push(args[1]->copy(Value::OBJECT_VALUE));
-									} else {
-										list->push(args[1]);
-									}
-									return None::empty();
-								})},
-	{"pop", BuiltinRPNFunction("pop", {{"list", {LIST, ANY}}}, NONE,
-							   [](RPNFunctionArgsValue &args, const TextRange & /*range*/,
-								  ContextPtr context) -> RPNFunctionResult {
-								   auto *list = dynamic_cast<List *>(args[0]);
-								   if (list->size() == 0) {
-									   return ExpressionResult("Cannot pop from empty list",
-															   args[0]->getRange(), context);
-								   }
-								   list->pop();
-								   return None::empty();
-							   })},
-	{"insert",
-	 BuiltinRPNFunction("insert", {{"list", {LIST, ANY}}, {"index", INT}, {"value", ANY}}, NONE,
-						[](RPNFunctionArgsValue &args, const TextRange & /*range*/,
-						   ContextPtr context) -> RPNFunctionResult {
-							auto *list = dynamic_cast<List *>(args[0]);
-							if (ExpressionResult result = checkListType(list, args[1], context);
-								result.error()) {
-								return result;
-							}
-							auto index = dynamic_cast<Int *>(args[1]);
+		 list->remove(index->getValue());
+		 return None::empty();
+	 }},
+	{"clear", {{"list", {LIST, ANY}}}, NONE,
+	 [](RPNFunctionArgsValue &args, const TextRange & /*range*/,
+		ContextPtr /*context*/) -> RPNFunctionResult {
+		 dynamic_cast<List *>(args[0])->clear();
+		 return None::empty();
+	 }},
+	{"listSum", {{"list", {LIST, ANY}}}, FLOAT, ReturnRule::LIST_ELEMENTS,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 auto *list = dynamic_cast<List *>(args[0]);
+		 if (ExpressionResult result = checkNumericList(list, true, context); result.error()) {
+			 return result;
+		 }
+		 if (list->isIntegral()) {
+			 std::vector<int64_t> const values = list->toInts();
+			 return integerReduction(simd::sum(values.data(), values.size()),
+									 holdsIntegers(list), range);
+		 }
+		 std::vector<float> const values = list->toFloats();
+		 return new Float(simd::sum(values.data(), values.size()), range, Value::INTERPRETER);
+	 }},
+	{"listMin", {{"list", {LIST, ANY}}}, FLOAT, ReturnRule::LIST_ELEMENTS,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 auto *list = dynamic_cast<List *>(args[0]);
+		 if (ExpressionResult result = checkNumericList(list, false, context); result.error()) {
+			 return result;
+		 }
+		 if (list->isIntegral()) {
+			 std::vector<int64_t> const values = list->toInts();
+			 return integerReduction(simd::min(values.data(), values.size()),
+									 holdsIntegers(list), range);
+		 }
+		 std::vector<float> const values = list->toFloats();
+		 return new Float(simd::min(values.data(), values.size()), range, Value::INTERPRETER);
+	 }},
+	{"listMax", {{"list", {LIST, ANY}}}, FLOAT, ReturnRule::LIST_ELEMENTS,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 auto *list = dynamic_cast<List *>(args[0]);
+		 if (ExpressionResult result = checkNumericList(list, false, context); result.error()) {
+			 return result;
+		 }
+		 if (list->isIntegral()) {
+			 std::vector<int64_t> const values = list->toInts();
+			 return integerReduction(simd::max(values.data(), values.size()),
+									 holdsIntegers(list), range);
+		 }
+		 std::vector<float> const values = list->toFloats();
+		 return new Float(simd::max(values.data(), values.size()), range, Value::INTERPRETER);
+	 }},
+	{"listMean", {{"list", {LIST, ANY}}}, FLOAT,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 auto *list = dynamic_cast<List *>(args[0]);
+		 if (ExpressionResult result = checkNumericList(list, false, context); result.error()) {
+			 return result;
+		 }
+		 std::vector<float> const values = list->toFloats();
+		 return new Float(simd::sum(values.data(), values.size()) /
+							  static_cast<float>(values.size()),
+						  range, Value::INTERPRETER);
+	 }},
+	{"listDot", {{"left", {LIST, ANY}}, {"right", {LIST, ANY}}}, FLOAT,
+	 ReturnRule::LIST_ELEMENTS,
+	 [](RPNFunctionArgsValue &args, const TextRange &range,
+		ContextPtr context) -> RPNFunctionResult {
+		 auto *left = dynamic_cast<List *>(args[0]);
+		 auto *right = dynamic_cast<List *>(args[1]);
+		 for (const List *list : {left, right}) {
+			 if (ExpressionResult result = checkNumericList(list, true, context); result.error()) {
+				 return result;
+			 }
+		 }
+		 if (left->size() != right->size()) {
+			 return ExpressionResult("Lists must have the same size",
+									 TextRange::merge(left->getRange(), right->getRange()),
+									 context);
+		 }
+		 if (left->isIntegral() && right->isIntegral()) {
+			 std::vector<int64_t> const leftValues = left->toInts();
+			 std::vector<int64_t> const rightValues = right->toInts();
+			 return integerReduction(
+				 simd::dot(leftValues.data(), rightValues.data(), leftValues.size()),
+				 holdsIntegers(left) && holdsIntegers(right), range);
+		 }
+		 std::vector<float> const leftValues = left->toFloats();
+		 std::vector<float> const rightValues = right->toFloats();
+		 return new Float(simd::dot(leftValues.data(), rightValues.data(), leftValues.size()),
+						  range, Value::INTERPRETER);
+	 }}};
 
-							if (index->getValue() < 0 || index->getValue() > list->size()) {
-								return ExpressionResult("Index out of range", args[1]->getRange(),
-														context);
-							}
-							if (args[2]->getOwner() == Value::CONTEXT_VARIABLE ||
-								args[2]->getOwner() == Value::OBJECT_VALUE) {
-								list->insert(index->getValue(), args[2]->copy(Value::OBJECT_VALUE));
-							} else {
-								list->insert(index->getValue(), args[2]);
-							}
-							return None::empty();
-						})},
-	{"remove", BuiltinRPNFunction("remove", {{"list", {LIST, ANY}}, {"index", INT}}, NONE,
-								  [](RPNFunctionArgsValue &args, const TextRange & /*range*/,
-									 ContextPtr context) -> RPNFunctionResult {
-									  auto *list = dynamic_cast<List *>(args[0]);
-									  auto const index = dynamic_cast<Int *>(args[1]);
-									  if (index->getValue() < 0 ||
-										  index->getValue() >= list->size()) {
-										  return ExpressionResult("Index out of range",
-																  args[1]->getRange(), context);
-									  }
+constexpr size_t tableSize = 128;
+constexpr uint8_t emptySlot = 0xFF;
+static_assert(std::size(descriptions) < emptySlot && std::size(descriptions) <= tableSize / 2);
 
-									  list->remove(index->getValue());
-									  return None::empty();
-								  })},
-	{"clear", BuiltinRPNFunction("clear", {{"list", {LIST, ANY}}}, NONE,
-								 [](RPNFunctionArgsValue &args, const TextRange & /*range*/,
-									ContextPtr /*context*/) -> RPNFunctionResult {
-									 dynamic_cast<List *>(args[0])->clear();
-									 return None::empty();
-								 })}};
\ No newline at end of file
+constexpr uint32_t hashName(std::string_view name, uint32_t seed) {
+	uint32_t hash = 2166136261U ^ seed;
+	for (const char c : name) {
+		hash = (hash ^ static_cast<uint8_t>(c)) * 16777619U;
+	}
+	return hash ^ (hash >> 15);
+}
+
+/**
+ * @brief find a seed for which every builtin name has its own slot in the table, the search runs
+ * at compile time so a lookup is a single hash and a string comparison
+ */
+consteval uint32_t findSeed() {
+	for (uint32_t seed = 0;; seed++) {
+		std::array<bool, tableSize> used{};
+		bool collision = false;
+		for (const BuiltinDescription &description : descriptions) {
+			bool &slot = used[hashName(description.name, seed) & (tableSize - 1)];
+			collision |= slot;
+			slot = true;
+		}
+		if (!collision) {
+			return seed;
+		}
+	}
+}
+
+constexpr uint32_t seed = findSeed();
+
+constexpr std::array<uint8_t, tableSize> slots = [] {
+	std::array<uint8_t, tableSize> slots{};
+	slots.fill(emptySlot);
+	for (size_t i = 0; i < std::size(descriptions); i++) {
+		slots[hashName(descriptions[i].name, seed) & (tableSize - 1)] = static_cast<uint8_t>(i);
+	}
+	return slots;
+}();
+
+RPNValueType toValueType(BuiltinType type) {
+	return {type.type, type.listType};
+}
+
+struct BuiltinTable {
+	std::vector<BuiltinRPNFunction> functions;
+	// index of the builtin of each symbol id, the builtin names are interned with the table
+	std::vector<uint8_t> symbolSlots;
+};
+
+/**
+ * @brief create the function objects of the builtins, only done the first time a builtin is looked
+ * up so the startup doesn't pay for it
+ */
+const BuiltinTable &table() {
+	static const BuiltinTable table = [] {
+		BuiltinTable table;
+		table.functions.reserve(std::size(descriptions));
+		for (const BuiltinDescription &description : descriptions) {
+			RPNFunctionArgs arguments;
+			for (size_t i = 0; i < description.argumentsCount; i++) {
+				arguments.emplace_back(std::string(description.arguments[i].name),
+									   toValueType(description.arguments[i].type));
+			}
+			const Symbol symbol(description.name);
+			if (symbol.id() >= table.symbolSlots.size()) {
+				table.symbolSlots.resize(symbol.id() + 1, emptySlot);
+			}
+			table.symbolSlots[symbol.id()] = static_cast<uint8_t>(table.functions.size());
+			table.functions.emplace_back(description.name, arguments,
+										 toValueType(description.returnType),
+										 description.function, description.returnRule);
+		}
+		return table;
+	}();
+	return table;
+}
+} // namespace
+
+/**
+ * @brief find a builtin function by its name
+ *
+ * @param name the name of the function
+ * @return const BuiltinRPNFunction* the function or nullptr if there is no builtin with this name
+ */
+const BuiltinRPNFunction *builtins::find(std::string_view name) {
+	const uint8_t slot = slots[hashName(name, seed) & (tableSize - 1)];
+	if (slot == emptySlot || descriptions[slot].name != name) {
+		return nullptr;
+	}
+	return &table().functions[slot];
+}
+
+/**
+ * @brief find a builtin function by its symbol, without hashing its name
+ *
+ * @param name the symbol of the function
+ * @return const BuiltinRPNFunction* the function or nullptr if there is no builtin with this name
+ */
+const BuiltinRPNFunction *builtins::findSymbol(Symbol name) {
+	const BuiltinTable &builtins = table();
+	if (name.id() >= builtins.symbolSlots.size() ||
+		builtins.symbolSlots[name.id()] == emptySlot) {
+		return nullptr;
+	}
+	return &builtins.functions[builtins.symbolSlots[name.id()]];
+}
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <initializer_list>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
 #include "context/context.hpp"
@@ -9,10 +12,13 @@
 #include "modules/module.hpp"
 #include "rpnfunctions/builtinsrpnfunction.hpp"
 #include "rpnfunctions/typedef.hpp"
+#include "simd/simd.hpp"
+#include "tokens/scanner.hpp"
 #include "value/value.hpp"
 #include "value/valuetypes.hpp"
 
 class BuiltinRPNFunction;
 namespace builtins {
-extern const std::unordered_map<std::string, BuiltinRPNFunction> builtinFunctions;
+const BuiltinRPNFunction *find(std::string_view name);
+const BuiltinRPNFunction *findSymbol(Symbol name);
 };
\ No newline at end of file
@@ -1,30 +1,36 @@
 #include "rpnfunctions/userrpnfunction.hpp"
 
-UserRPNFunction::UserRPNFunction() : RPNFunction("", {}, NONE), body(nullptr) {}
+UserRPNFunction::UserRPNFunction()
+	: RPNFunction("", {}, NONE), body(nullptr), callCounter(RuntimeStats::functionCounter("")) {}
 UserRPNFunction::UserRPNFunction(const UserRPNFunction &other)
-	: RPNFunction(other.name, other.arguments, other.returnType), body(other.body) {}
+	: RPNFunction(other.name, other.arguments, other.returnType), body(other.body),
+	  argumentSymbols(other.argumentSymbols), callCounter(other.callCounter) {}
 
 UserRPNFunction::UserRPNFunction(const std::string &name, const RPNFunctionArgs &arguments,
 								 const RPNValueType &returnType, CodeBlock *body)
-	: RPNFunction(name, arguments, returnType), body(body) {}
-
-UserRPNFunction::~UserRPNFunction() {
-	if (this->body != nullptr) {
-		delete this->body;
+	: RPNFunction(name, arguments, returnType), body(body),
+	  callCounter(RuntimeStats::functionCounter(name)) {
+	for (const auto &argument : arguments) {
+		this->argumentSymbols.emplace_back(argument.first);
 	}
 }
 
+UserRPNFunction::~UserRPNFunction() = default;
+
 RPNFunctionResult UserRPNFunction::call(RPNFunctionArgsValue &args, const TextRange & /*range*/,
 										ContextPtr context) const {
+	Profiler::Frame frame(this, this->getRange().line);
+	const Tracer::Span span("function", this->name);
+	this->callCounter->fetch_add(1, std::memory_order_relaxed);
 	ContextPtr const functionContext =
 		std::make_shared<Context>(this->name, "", context, CONTEXT_TYPE_FUNCTION);
 	for (size_t i = 0; i < args.size(); i++) {
 		if (this->arguments.at(i).second.index() == 0) {
-			functionContext->setValue(this->arguments.at(i).first,
+			functionContext->setValue(this->argumentSymbols[i],
 									  args[i]->copy(Value::CONTEXT_VARIABLE));
 		} else {
 			functionContext->setValue(
-				this->arguments.at(i).first,
+				this->argumentSymbols[i],
 				args[i]->to(std::get<ValueType>(this->arguments.at(i).second.getType()),
 							Value::CONTEXT_VARIABLE));
 		}
@@ -50,12 +56,16 @@ RPNFunctionResult UserRPNFunction::call(RPNFunctionArgsValue &args, const TextRa
 	}
 
 	Value *returnValue = interpreter.getLastValue();
+	// the shared constant values have no range, their errors are located at the end of the body
+	const TextRange returnRange = returnValue->getOwner() == Value::CONSTANT
+									  ? this->body->lastRange()
+									  : returnValue->getRange();
 	if (this->returnType.index() == 0) {
 		if (returnValue->getType() != STRUCT) {
 			return ExpressionResult("Return type must be struct of type " +
 										this->returnType.name() + " but got " +
 										stringType(returnValue->getType()),
-									returnValue->getRange(), context);
+									returnRange, context);
 		}
 
 		if (std::get<std::string>(this->returnType.getType()) !=
@@ -63,7 +73,7 @@ RPNFunctionResult UserRPNFunction::call(RPNFunctionArgsValue &args, const TextRa
 			return ExpressionResult(
 				"Return type must be struct of type " + this->returnType.name() + " but got " +
 					std::string(dynamic_cast<Struct *>(returnValue)->getStructName()),
-				returnValue->getRange(), context);
+				returnRange, context);
 		}
 
 		return returnValue->copy();
@@ -78,7 +88,7 @@ RPNFunctionResult UserRPNFunction::call(RPNFunctionArgsValue &args, const TextRa
 									std::get<ValueType>(this->returnType.getType()))) {
 		return ExpressionResult("Return type must be " + this->returnType.name() + " but got " +
 									stringType(returnValue->getType()),
-								returnValue->getRange(), context);
+								returnRange, context);
 	}
 
 	return returnValue->to(std::get<ValueType>(this->returnType.getType()));
@@ -3,6 +3,8 @@
 #include "codeblocks/codeblock.hpp"
 #include "interpreter/interpreter.hpp"
 #include "rpnfunctions/rpnfunction.hpp"
+#include "runtimestats/runtimestats.hpp"
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 
@@ -29,7 +31,10 @@ class UserRPNFunction : public RPNFunction {
 
   private:
 	void addParameters(RPNFunctionArgs &args, const ContextPtr &context) const;
+	// owned by the arena of the compilation unit defining the function
 	CodeBlock *body;
+	std::vector<Symbol> argumentSymbols;
+	std::atomic<uint64_t> *callCounter;
 
 	static std::unordered_map<std::string, std::shared_ptr<UserRPNFunction>> userFunctions;
 };
\ No newline at end of file
@@ -6,7 +6,8 @@ do
 	echo "============================================================"
 	echo "Testing $example"
 	echo "============================================================"
-	./RPNlang "$example"
+	# a value which is never deleted makes the test fail
+	./RPNlang --check-leaks "$example"
 	if [ $? -ne 0 ]
 	then
 		echo "Test $example failed"
@@ -15,4 +16,21 @@ do
 	echo
 done
 
+# these tests must fail, the first line of each one is the error it must report
+for example in ../tests/errors/*.rpn
+do
+	echo "============================================================"
+	echo "Testing $example"
+	echo "============================================================"
+	expected=$(head -n 1 "$example" | sed 's/^# expect: //')
+	output=$(./RPNlang --check-leaks "$example" 2>&1)
+	if [ $? -eq 0 ] || ! echo "$output" | grep -qF "$expected"
+	then
+		echo "$output"
+		echo "Test $example failed, expected: $expected"
+		exit 1
+	fi
+	echo
+done
+
 echo "Done"
\ No newline at end of file